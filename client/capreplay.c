@@ -0,0 +1,578 @@
+// capreplay.c
+// 트래픽 캡처 재생 도구
+//
+// 서버의 -C 옵션으로 남긴 캡처 파일(common/capture.h)을 읽어, 기록된 연결마다 소켓을 열고
+// 받은 프레임을 바이트 그대로 다시 보낸다. 서버 응답은 읽어서 세기만 하고 버린다.
+// 실제 운영 트래픽 모양 그대로 이벤트 루프와 핸들러를 반복 측정하거나, 장애 상황을 재현하는 데 쓴다.
+//
+// 사용법:
+//   capreplay [-h <host>] [-p <port>] [-x <speed>] [-s] [-w <linger ms>] <capture file>
+//
+// -x 1 은 기록된 간격 그대로(기본값), 2는 두 배 빠르게, 0은 기다리지 않고 최대한 빨리 보낸다.
+// -s 는 프레임마다 같은 연결의 첫 응답을 (최대 REPLAY_LOCKSTEP_TIMEOUT_MS까지) 기다린 뒤 다음 프레임을 보낸다.
+// 연결 사이의 처리 순서가 캡처와 같아져 매칭 짝과 게임 진행이 반복 실행마다 같게 재현된다.
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "capture.h"
+#include "config.h"
+#include "metrics.h"
+
+#define REPLAY_MAX_EVENTS          256
+#define REPLAY_MAX_FRAME           (16 * 1024 * 1024)  // 이보다 큰 프레임은 깨진 파일로 본다
+#define REPLAY_READ_CHUNK          (64 * 1024)
+#define REPLAY_BATCH               64    // 이벤트를 확인하기 전에 한 번에 보내는 최대 레코드 수
+#define REPLAY_LINGER_MS           1000  // 마지막 프레임 뒤 응답을 기다리는 기본 시간
+#define REPLAY_LOCKSTEP_TIMEOUT_MS 200   // -s에서 응답 없는 프레임을 기다리는 최대 시간
+#define REPLAY_MAX_CONN_GAP        1024  // 지금까지 본 최대 연결 번호보다 이만큼 넘게 큰 번호는 깨진 파일로 본다
+
+typedef struct {
+    int      fd;           // -1이면 연결 없음
+    bool     closing;      // 출력 버퍼를 다 보내면 쓰기 쪽을 닫는다 (CLOSE 레코드)
+    bool     half_closed;  // 쓰기 쪽을 닫고 서버가 남은 응답을 보낸 뒤 닫기를 기다리는 중
+    bool     want_write;
+    uint8_t *out;
+    size_t   out_len;
+    size_t   out_cap;
+
+    // 응답 프레임 경계 추적 (길이 접두어만 읽고 본문은 건너뛴다)
+    uint8_t  prefix[4];
+    uint32_t prefix_have;
+    uint32_t body_left;
+} replay_conn_t;
+
+static struct {
+    const char *host;
+    int         port;
+    double      speed;  // 0이면 최대 속도
+    bool        lockstep;
+    int         linger_ms;
+    const char *path;
+} g_opts = {
+    .host      = DEFAULT_SERVER_HOST,
+    .port      = DEFAULT_SERVER_PORT,
+    .speed     = 1.0,
+    .lockstep  = false,
+    .linger_ms = REPLAY_LINGER_MS,
+    .path      = NULL,
+};
+
+static struct {
+    uint64_t     records;
+    uint64_t     connections;
+    uint64_t     connect_failures;
+    uint64_t     skipped_frames;  // 연결을 열지 못해 보내지 못한 프레임
+    uint64_t     server_closes;
+    uint64_t     frames_sent;
+    uint64_t     bytes_sent;
+    uint64_t     frames_received;
+    uint64_t     bytes_received;
+    uint64_t     unanswered;  // -s에서 제한 시간 안에 응답이 없던 프레임
+    metric_hdr_t lag;         // 예정 시각보다 늦게 보낸 정도 (-x > 0)
+    metric_hdr_t reply;       // 프레임 → 같은 연결의 첫 응답 (-s)
+} g_stats;
+
+static replay_conn_t          *g_conns;
+static size_t                  g_conn_cap;
+static uint32_t                g_max_conn_id;  // 지금까지 읽은 레코드의 최대 연결 번호
+static int                     g_epfd = -1;
+static struct sockaddr_storage g_addr;
+static socklen_t               g_addr_len;
+
+// -s 상태: 응답을 기다리는 연결 (0이면 없음)
+static uint32_t g_wait_conn;
+static uint64_t g_wait_sent_ns;
+static uint64_t g_wait_deadline_ns;
+
+static volatile sig_atomic_t g_stop = 0;
+
+static void handle_signal(int sig) {
+    (void)sig;
+    g_stop = 1;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// ---------------------------------------------------------------------------
+// 캡처 파일 읽기
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    capture_rec_header_t header;
+    uint8_t             *frame;  // FRAME: 길이 접두어 + 본문
+    uint32_t             frame_len;
+    uint32_t             frame_cap;
+} replay_record_t;
+
+// 다음 레코드를 읽는다 (파일 끝이면 0, 깨졌으면 -1)
+static int read_record(FILE *in, replay_record_t *rec) {
+    size_t n = fread(&rec->header, 1, sizeof(rec->header), in);
+    if (n == 0 && feof(in))
+        return 0;
+    if (n != sizeof(rec->header))
+        return -1;
+
+    // 서버는 연결 번호를 1부터 차례로 붙이므로 새 번호는 최대 번호 바로 다음이어야 한다
+    // (번호를 그대로 배열 인덱스로 쓰므로 크게 튀는 번호는 받지 않는다)
+    uint32_t conn_id = rec->header.conn_id;
+    if (conn_id == 0 || (uint64_t)conn_id > (uint64_t)g_max_conn_id + REPLAY_MAX_CONN_GAP)
+        return -1;
+    if (conn_id > g_max_conn_id)
+        g_max_conn_id = conn_id;
+
+    rec->frame_len = 0;
+    if (rec->header.type != CAPTURE_REC_FRAME)
+        return rec->header.type == CAPTURE_REC_OPEN || rec->header.type == CAPTURE_REC_CLOSE ? 1 : -1;
+
+    uint8_t prefix[4];
+    if (fread(prefix, 1, 4, in) != 4)
+        return -1;
+    uint32_t body_len;
+    memcpy(&body_len, prefix, 4);
+    body_len = ntohl(body_len);
+    if (body_len > REPLAY_MAX_FRAME)
+        return -1;
+
+    if (rec->frame_cap < 4 + body_len) {
+        uint8_t *frame = realloc(rec->frame, 4 + body_len);
+        if (!frame)
+            return -1;
+        rec->frame     = frame;
+        rec->frame_cap = 4 + body_len;
+    }
+    memcpy(rec->frame, prefix, 4);
+    if (fread(rec->frame + 4, 1, body_len, in) != body_len)
+        return -1;
+    rec->frame_len = 4 + body_len;
+    return 1;
+}
+
+// ---------------------------------------------------------------------------
+// 연결
+// ---------------------------------------------------------------------------
+
+static replay_conn_t *conn_get(uint32_t id) {
+    if (id >= g_conn_cap) {
+        size_t cap = g_conn_cap ? g_conn_cap : 256;
+        while (cap <= id)
+            cap *= 2;
+        replay_conn_t *conns = realloc(g_conns, (size_t)cap * sizeof(replay_conn_t));
+        if (!conns) {
+            perror("realloc");
+            exit(EXIT_FAILURE);
+        }
+        memset(conns + g_conn_cap, 0, (cap - g_conn_cap) * sizeof(replay_conn_t));
+        for (size_t i = g_conn_cap; i < cap; i++)
+            conns[i].fd = -1;
+        g_conns    = conns;
+        g_conn_cap = cap;
+    }
+    return &g_conns[id];
+}
+
+static void conn_close(uint32_t id) {
+    replay_conn_t *c = &g_conns[id];
+    if (c->fd < 0)
+        return;
+    epoll_ctl(g_epfd, EPOLL_CTL_DEL, c->fd, NULL);
+    close(c->fd);
+    c->fd          = -1;
+    c->closing     = false;
+    c->half_closed = false;
+    c->want_write  = false;
+    c->out_len     = 0;
+    c->prefix_have = 0;
+    c->body_left   = 0;
+    if (g_wait_conn == id)
+        g_wait_conn = 0;
+}
+
+// 재생은 캡처 순서가 중요하므로 connect는 끝날 때까지 기다린 뒤 논블로킹으로 바꾼다
+static void conn_open(uint32_t id) {
+    replay_conn_t *c = conn_get(id);
+    if (c->fd >= 0)
+        conn_close(id);
+
+    int fd = socket(g_addr.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&g_addr, g_addr_len) < 0) {
+        if (fd >= 0)
+            close(fd);
+        g_stats.connect_failures++;
+        return;
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+    struct epoll_event ev;
+    ev.events   = EPOLLIN;
+    ev.data.u32 = id;
+    if (epoll_ctl(g_epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        close(fd);
+        g_stats.connect_failures++;
+        return;
+    }
+    c->fd = fd;
+    g_stats.connections++;
+}
+
+static void conn_set_write(uint32_t id, bool want_write) {
+    replay_conn_t *c = &g_conns[id];
+    if (c->want_write == want_write)
+        return;
+    struct epoll_event ev;
+    ev.events   = EPOLLIN | (want_write ? EPOLLOUT : 0);
+    ev.data.u32 = id;
+    epoll_ctl(g_epfd, EPOLL_CTL_MOD, c->fd, &ev);
+    c->want_write = want_write;
+}
+
+static void conn_flush(uint32_t id) {
+    replay_conn_t *c    = &g_conns[id];
+    size_t         done = 0;
+    while (done < c->out_len) {
+        ssize_t n = send(c->fd, c->out + done, c->out_len - done, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            g_stats.server_closes++;
+            conn_close(id);
+            return;
+        }
+        done += (size_t)n;
+        g_stats.bytes_sent += (uint64_t)n;
+    }
+    memmove(c->out, c->out + done, c->out_len - done);
+    c->out_len -= done;
+
+    // 바로 닫으면 서버가 앞선 프레임의 응답을 보내다 실패하므로, 쓰기 쪽만 닫고 서버가 닫기를 기다린다
+    if (c->out_len == 0 && c->closing && !c->half_closed) {
+        shutdown(c->fd, SHUT_WR);
+        c->half_closed = true;
+    }
+    conn_set_write(id, c->out_len > 0);
+}
+
+static bool conn_send(uint32_t id, const uint8_t *frame, uint32_t len) {
+    replay_conn_t *c = &g_conns[id];
+    if (c->out_len + len > c->out_cap) {
+        size_t cap = c->out_cap ? c->out_cap : 4096;
+        while (cap < c->out_len + len)
+            cap *= 2;
+        uint8_t *out = realloc(c->out, cap);
+        if (!out)
+            return false;
+        c->out     = out;
+        c->out_cap = cap;
+    }
+    memcpy(c->out + c->out_len, frame, len);
+    c->out_len += len;
+    g_stats.frames_sent++;
+    if (!c->want_write)
+        conn_flush(id);
+    return true;
+}
+
+// 응답을 읽어 프레임 수만 센다 (본문은 해석하지 않는다)
+static void conn_read(uint32_t id) {
+    static uint8_t buf[REPLAY_READ_CHUNK];
+    replay_conn_t *c = &g_conns[id];
+
+    ssize_t n = recv(c->fd, buf, sizeof(buf), 0);
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+        if (!c->half_closed)
+            g_stats.server_closes++;
+        conn_close(id);
+        return;
+    }
+    if (n < 0)
+        return;
+    g_stats.bytes_received += (uint64_t)n;
+
+    size_t pos = 0;
+    while (pos < (size_t)n) {
+        if (c->body_left > 0) {
+            size_t take = (size_t)n - pos < c->body_left ? (size_t)n - pos : c->body_left;
+            c->body_left -= (uint32_t)take;
+            pos += take;
+            continue;
+        }
+        c->prefix[c->prefix_have++] = buf[pos++];
+        if (c->prefix_have < 4)
+            continue;
+
+        uint32_t body_len;
+        memcpy(&body_len, c->prefix, 4);
+        c->body_left   = ntohl(body_len);
+        c->prefix_have = 0;
+        g_stats.frames_received++;
+
+        if (g_wait_conn == id) {
+            metric_hdr_record(&g_stats.reply, now_ns() - g_wait_sent_ns);
+            g_wait_conn = 0;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 재생
+// ---------------------------------------------------------------------------
+
+static void replay_record(const replay_record_t *rec) {
+    uint32_t id = rec->header.conn_id;
+    g_stats.records++;
+
+    switch (rec->header.type) {
+        case CAPTURE_REC_OPEN:
+            conn_open(id);
+            break;
+        case CAPTURE_REC_CLOSE:
+            if (id < g_conn_cap && g_conns[id].fd >= 0) {
+                g_conns[id].closing = true;
+                conn_flush(id);
+            }
+            break;
+        case CAPTURE_REC_FRAME: {
+            // OPEN 없이 시작된 연결(캡처 전에 열린 연결)은 첫 프레임에서 연다
+            replay_conn_t *c = conn_get(id);
+            if (c->fd < 0)
+                conn_open(id);
+            if (c->fd < 0 || !conn_send(id, rec->frame, rec->frame_len)) {
+                g_stats.skipped_frames++;
+                break;
+            }
+            if (g_opts.lockstep && c->fd >= 0) {
+                g_wait_conn        = id;
+                g_wait_sent_ns     = now_ns();
+                g_wait_deadline_ns = g_wait_sent_ns + REPLAY_LOCKSTEP_TIMEOUT_MS * 1000000ull;
+            }
+            break;
+        }
+    }
+}
+
+static void handle_events(int timeout_ms) {
+    struct epoll_event events[REPLAY_MAX_EVENTS];
+    int                n = epoll_wait(g_epfd, events, REPLAY_MAX_EVENTS, timeout_ms);
+    for (int i = 0; i < n; i++) {
+        uint32_t id = events[i].data.u32;
+        if (id >= g_conn_cap || g_conns[id].fd < 0)
+            continue;
+        if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+            conn_read(id);
+        if (g_conns[id].fd >= 0 && (events[i].events & EPOLLOUT))
+            conn_flush(id);
+    }
+}
+
+static int ms_until(uint64_t deadline, uint64_t now) {
+    return deadline > now ? (int)((deadline - now + 999999) / 1000000) : 0;
+}
+
+static void print_report(double elapsed) {
+    double secs = elapsed > 0 ? elapsed : 1;
+
+    printf("\n=== capreplay report (%.3fs) ===\n", elapsed);
+    printf("Records:     %" PRIu64 ", connections %" PRIu64 " (%" PRIu64 " failed), closed by server %" PRIu64 "\n",
+           g_stats.records, g_stats.connections, g_stats.connect_failures, g_stats.server_closes);
+    printf("Frames:      %" PRIu64 " sent (%.1f/s), %" PRIu64 " skipped, %" PRIu64 " received (%.1f/s)\n",
+           g_stats.frames_sent, (double)g_stats.frames_sent / secs, g_stats.skipped_frames,
+           g_stats.frames_received, (double)g_stats.frames_received / secs);
+    printf("Bytes:       %" PRIu64 " sent, %" PRIu64 " received\n", g_stats.bytes_sent, g_stats.bytes_received);
+
+    metric_hdr_t *rows[]  = {&g_stats.lag, &g_stats.reply};
+    const char   *names[] = {"send lag", "reply"};
+    printf("\nLatency (ms)      count       p50       p90       p99     p99.9       max\n");
+    for (int i = 0; i < 2; i++) {
+        if (atomic_load(&rows[i]->count) == 0)
+            continue;
+        printf("%-10s %12llu %9.3f %9.3f %9.3f %9.3f %9.3f\n", names[i],
+               (unsigned long long)atomic_load(&rows[i]->count),
+               metric_hdr_quantile(rows[i], 0.5) / 1e6, metric_hdr_quantile(rows[i], 0.9) / 1e6,
+               metric_hdr_quantile(rows[i], 0.99) / 1e6, metric_hdr_quantile(rows[i], 0.999) / 1e6,
+               (double)atomic_load(&rows[i]->max_ns) / 1e6);
+    }
+    if (g_opts.lockstep)
+        printf("Unanswered:  %" PRIu64 " frame(s) without a reply within %dms\n", g_stats.unanswered, REPLAY_LOCKSTEP_TIMEOUT_MS);
+}
+
+static void print_usage(const char *prog) {
+    fprintf(stderr, "Usage: %s [-h <host>] [-p <port>] [-x <speed>] [-s] [-w <linger ms>] <capture file>\n", prog);
+}
+
+static bool resolve_server(void) {
+    char port[16];
+    snprintf(port, sizeof(port), "%d", g_opts.port);
+
+    struct addrinfo hints = {0};
+    hints.ai_family       = AF_UNSPEC;
+    hints.ai_socktype     = SOCK_STREAM;
+
+    struct addrinfo *res = NULL;
+    int              rc  = getaddrinfo(g_opts.host, port, &hints, &res);
+    if (rc != 0) {
+        fprintf(stderr, "Cannot resolve %s: %s\n", g_opts.host, gai_strerror(rc));
+        return false;
+    }
+    memcpy(&g_addr, res->ai_addr, res->ai_addrlen);
+    g_addr_len = res->ai_addrlen;
+    freeaddrinfo(res);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-h") == 0 && i + 1 < argc) {
+            g_opts.host = argv[++i];
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            g_opts.port = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-x") == 0 && i + 1 < argc) {
+            g_opts.speed = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-s") == 0) {
+            g_opts.lockstep = true;
+        } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+            g_opts.linger_ms = atoi(argv[++i]);
+        } else if (argv[i][0] != '-' && !g_opts.path) {
+            g_opts.path = argv[i];
+        } else {
+            print_usage(argv[0]);
+            return 2;
+        }
+    }
+    if (!g_opts.path || g_opts.speed < 0 || g_opts.linger_ms < 0 || g_opts.port <= 0 || g_opts.port > 65535) {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    FILE *in = fopen(g_opts.path, "rb");
+    if (!in) {
+        fprintf(stderr, "Cannot open %s: %s\n", g_opts.path, strerror(errno));
+        return 1;
+    }
+    capture_header_t header;
+    if (fread(&header, 1, sizeof(header), in) != sizeof(header) || header.magic != CAPTURE_MAGIC) {
+        fprintf(stderr, "%s: not a capture file\n", g_opts.path);
+        fclose(in);
+        return 1;
+    }
+    if (header.version != CAPTURE_VERSION) {
+        fprintf(stderr, "%s: unsupported capture version %u\n", g_opts.path, header.version);
+        fclose(in);
+        return 1;
+    }
+    if (!resolve_server()) {
+        fclose(in);
+        return 1;
+    }
+
+    // 캡처된 동시 연결 수만큼 fd를 쓸 수 있게 소프트 한도를 올린다
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < rl.rlim_max) {
+        rl.rlim_cur = rl.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &rl);
+    }
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, handle_signal);
+    signal(SIGTERM, handle_signal);
+
+    g_epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (g_epfd < 0) {
+        perror("epoll_create1");
+        fclose(in);
+        return 1;
+    }
+
+    char speed[32];
+    if (g_opts.speed > 0)
+        snprintf(speed, sizeof(speed), "%.2fx", g_opts.speed);
+    else
+        snprintf(speed, sizeof(speed), "max");
+    printf("capreplay: %s -> %s:%d, speed %s%s\n", g_opts.path, g_opts.host, g_opts.port, speed,
+           g_opts.lockstep ? ", lockstep" : "");
+
+    replay_record_t rec   = {0};
+    int             state = read_record(in, &rec);
+
+    uint64_t start   = now_ns();
+    int64_t  base_ts = state > 0 ? rec.header.ts_ns : 0;  // 첫 레코드가 재생 시작 시각에 맞춰진다
+    while (!g_stop && state > 0) {
+        uint64_t now = now_ns();
+
+        // -s: 직전 프레임의 응답을 기다린다
+        if (g_wait_conn) {
+            if (now < g_wait_deadline_ns) {
+                handle_events(ms_until(g_wait_deadline_ns, now));
+                continue;
+            }
+            g_stats.unanswered++;
+            g_wait_conn = 0;
+        }
+
+        uint64_t due = now;
+        if (g_opts.speed > 0) {
+            int64_t offset = rec.header.ts_ns > base_ts ? rec.header.ts_ns - base_ts : 0;
+            due            = start + (uint64_t)((double)offset / g_opts.speed);
+        }
+        if (due > now) {
+            handle_events(ms_until(due, now));
+            continue;
+        }
+
+        // 예정 시각이 지난 레코드를 몰아서 보내되, 응답을 읽을 틈을 남긴다
+        for (int batch = 0; batch < REPLAY_BATCH && state > 0 && !g_wait_conn; batch++) {
+            if (g_opts.speed > 0) {
+                int64_t  offset = rec.header.ts_ns > base_ts ? rec.header.ts_ns - base_ts : 0;
+                uint64_t when   = start + (uint64_t)((double)offset / g_opts.speed);
+                if (when > now)
+                    break;
+                if (rec.header.type == CAPTURE_REC_FRAME)
+                    metric_hdr_record(&g_stats.lag, now - when);
+            }
+            replay_record(&rec);
+            state = read_record(in, &rec);
+        }
+        handle_events(0);
+    }
+    double elapsed = (double)(now_ns() - start) / 1e9;  // 처리량은 마지막 레코드까지로 계산한다
+    if (state < 0)
+        fprintf(stderr, "%s: truncated or corrupt record after %" PRIu64 " records\n", g_opts.path, g_stats.records);
+
+    // 남은 출력을 보내고 응답이 잦아들 때까지 기다린다
+    uint64_t linger_end = now_ns() + (uint64_t)g_opts.linger_ms * 1000000ull;
+    for (uint64_t now = now_ns(); !g_stop && now < linger_end; now = now_ns())
+        handle_events(ms_until(linger_end, now));
+
+    for (size_t id = 0; id < g_conn_cap; id++) {
+        conn_close((uint32_t)id);
+        free(g_conns[id].out);
+    }
+    print_report(elapsed);
+
+    free(g_conns);
+    free(rec.frame);
+    close(g_epfd);
+    fclose(in);
+    return state < 0 ? 1 : 0;
+}
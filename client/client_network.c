@@ -15,7 +15,9 @@
 #include "client_state.h"
 #include "handlers/handlers.h"
 #include "logger.h"
+#include "move.h"
 #include "network.h"
+#include "protocol_utils.h"
 
 // 서버 연결
 int connect_to_server() {
@@ -359,27 +361,9 @@ void send_chat_message(const char *message) {
     }
 }
 
-// 체스 좌표를 배열 인덱스로 변환 (예: "a1" -> (0, 0))
-static bool parse_chess_coordinate_network(const char *coord, int *x, int *y) {
-    if (!coord || strlen(coord) != 2) {
-        return false;
-    }
-
-    char file = coord[0];  // a-h
-    char rank = coord[1];  // 1-8
-
-    if (file < 'a' || file > 'h' || rank < '1' || rank > '8') {
-        return false;
-    }
-
-    *x = file - 'a';  // 0-7
-    *y = rank - '1';  // 0-7
-
-    return true;
-}
-
 // 기물 이동 요청 전송
-int send_move_request(const char *from, const char *to) {
+// promotion은 폰이 마지막 랭크에 도달할 때만 서버가 사용한다
+int send_move_request(const char *from, const char *to, piece_type_t promotion) {
     LOG_INFO("Sending move request: %s -> %s", from, to);
     client_state_t *client = get_client_state();
 
@@ -396,13 +380,13 @@ int send_move_request(const char *from, const char *to) {
 
     // 좌표 유효성 검사
     int from_x, from_y, to_x, to_y;
-    if (!parse_chess_coordinate_network(from, &from_x, &from_y)) {
+    if (!square_parse(from, &from_x, &from_y)) {
         LOG_ERROR("Invalid 'from' coordinate: %s", from);
         add_chat_message_safe("System", "Invalid source coordinate");
         return -1;
     }
 
-    if (!parse_chess_coordinate_network(to, &to_x, &to_y)) {
+    if (!square_parse(to, &to_x, &to_y)) {
         LOG_ERROR("Invalid 'to' coordinate: %s", to);
         add_chat_message_safe("System", "Invalid destination coordinate");
         return -1;
@@ -412,8 +396,9 @@ int send_move_request(const char *from, const char *to) {
     ClientMessage client_msg = CLIENT_MESSAGE__INIT;
     MoveRequest   move_req   = MOVE_REQUEST__INIT;
 
-    move_req.from = (char *)from;
-    move_req.to   = (char *)to;
+    move_req.from      = (char *)from;
+    move_req.to        = (char *)to;
+    move_req.promotion = piece_type_to_proto(promotion);
 
     // TODO: timestamp 설정 (필요시)
 
@@ -458,4 +443,50 @@ int send_resign_request() {
 
     LOG_INFO("Resign request sent successfully");
     return 0;
-}
\ No newline at end of file
+}
+
+int send_analyze_request(const move_t *moves, int count) {
+    client_state_t *client = get_client_state();
+
+    if (!client->connected) {
+        LOG_WARN("Cannot send analyze request: not connected to server");
+        return -1;
+    }
+    if (count <= 0) {
+        return 0;
+    }
+
+    // 좌표 표기 문자열 배열 (한 번에 할당)
+    char  *buf  = malloc((size_t)count * MOVE_STR_LEN);
+    char **strs = malloc((size_t)count * sizeof(char *));
+    if (!buf || !strs) {
+        LOG_ERROR("Failed to allocate analyze request");
+        free(buf);
+        free(strs);
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        strs[i] = buf + (size_t)i * MOVE_STR_LEN;
+        move_format(moves[i], strs[i]);
+    }
+
+    ClientMessage      analyze_msg = CLIENT_MESSAGE__INIT;
+    AnalyzeGameRequest analyze_req = ANALYZE_GAME_REQUEST__INIT;
+
+    analyze_req.n_moves      = (size_t)count;
+    analyze_req.moves        = strs;
+    analyze_msg.msg_case     = CLIENT_MESSAGE__MSG_ANALYZE_GAME;
+    analyze_msg.analyze_game = &analyze_req;
+
+    int result = send_client_message(client->socket_fd, &analyze_msg);
+    free(strs);
+    free(buf);
+
+    if (result < 0) {
+        LOG_ERROR("Failed to send analyze request");
+        return -1;
+    }
+
+    LOG_INFO("Analyze request sent (%d plies)", count);
+    return 0;
+}
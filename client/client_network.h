@@ -3,6 +3,9 @@
 
 #include <stdbool.h>
 
+#include "move.h"
+#include "types.h"
+
 // 서버 연결 설정
 #define SERVER_DEFAULT_HOST "127.0.0.1"
 #define SERVER_DEFAULT_PORT 8080
@@ -24,9 +27,12 @@ bool should_attempt_reconnect();
 void send_chat_message(const char *message);
 
 // 게임 관련
-int send_move_request(const char *from, const char *to);
+int send_move_request(const char *from, const char *to, piece_type_t promotion);
 int send_resign_request();
 
+// 끝난 게임 분석 요청 (시작 위치부터 둔 수, 결과는 채팅 창에 요약)
+int send_analyze_request(const move_t *moves, int count);
+
 #define RECONNECT_INTERVAL 5  // 5초마다 재연결 시도
 
 #endif  // CLIENT_CLIENT_NETWORK_H
\ No newline at end of file
@@ -17,9 +17,6 @@
 game_state_t *g_game_state = NULL;
 #define CURRENT_STATE (g_game_state)
 
-// piece_table 외부 선언 (common/piece.c에 정의됨)
-extern piece_t *piece_table[2][6];
-
 // 스레드 동기화 (외부에서 정의됨)
 extern pthread_mutex_t screen_mutex;
 
@@ -126,7 +123,7 @@ void add_chat_message(game_state_t *state, const char *sender, const char *messa
 
 // 유효한 수인지 확인 (기본 체크)
 bool is_valid_move(game_t *game, int from_x, int from_y, int to_x, int to_y) {
-    return is_move_legal(game, from_x, from_y, to_x, to_y);
+    return is_move_legal(game, move_make(from_x, from_y, to_x, to_y));
 }
 
 // 실제 수 실행
@@ -135,7 +132,7 @@ bool make_move(game_t *game, int from_x, int from_y, int to_x, int to_y) {
         return false;
     }
 
-    apply_move(game, from_x, from_y, to_x, to_y);
+    apply_move(game, move_make(from_x, from_y, to_x, to_y));
     return true;
 }
 
@@ -164,59 +161,31 @@ const char *get_opponent_name(const game_state_t *state) {
 }
 
 // 서버로부터 받은 이동을 보드에 적용
-bool apply_move_from_server(game_t *game, const char *from, const char *to) {
-    // NULL 포인터와 빈 문자열 검사
-    if (!game || !from || !to || strlen(from) != 2 || strlen(to) != 2) {
+bool apply_move_from_server(game_t *game, move_t move) {
+    if (!game || move == MOVE_NONE) {
         return false;
     }
 
-    // 체스 표기법을 좌표로 변환
-    // 체스 표기법: "a1" = file 'a' (0-7), rank '1' (0-7)
-    // apply_move 함수는 (x, y) 형식으로 받으므로 file을 x, rank를 y로 변환
-    int from_x = from[0] - 'a';  // file (a-h) -> x (0-7)
-    int from_y = from[1] - '1';  // rank (1-8) -> y (0-7)
-    int to_x   = to[0] - 'a';    // file (a-h) -> x (0-7)
-    int to_y   = to[1] - '1';    // rank (1-8) -> y (0-7)
-
-    // 범위 검사
-    if (from_x < 0 || from_x >= 8 || from_y < 0 || from_y >= 8 ||
-        to_x < 0 || to_x >= 8 || to_y < 0 || to_y >= 8) {
-        return false;
-    }
+    int from_x = move_from_x(move), from_y = move_from_y(move);
+    int to_x   = move_to_x(move), to_y = move_to_y(move);
 
     LOG_DEBUG("=== MOVE DEBUG START ===");
-    LOG_DEBUG("Applying server move: %s (%d,%d) -> %s (%d,%d)",
-              from, from_x, from_y, to, to_x, to_y);
-
-    // 이동 전 보드 상태 확인 (두 가지 접근 방식으로 확인)
-    piecestate_t *src_xy = &game->board[from_x][from_y];  // [x][y] 접근
-    piecestate_t *src_yx = &game->board[from_y][from_x];  // [y][x] 접근
-
-    LOG_DEBUG("Source [%d][%d] (x,y): piece=%p, dead=%d",
-              from_x, from_y, (void *)src_xy->piece, src_xy->is_dead);
-    LOG_DEBUG("Source [%d][%d] (y,x): piece=%p, dead=%d",
-              from_y, from_x, (void *)src_yx->piece, src_yx->is_dead);
+    LOG_DEBUG("Applying server move: (%d,%d) -> (%d,%d)", from_x, from_y, to_x, to_y);
 
-    piecestate_t *dst_xy = &game->board[to_x][to_y];  // [x][y] 접근
-    piecestate_t *dst_yx = &game->board[to_y][to_x];  // [y][x] 접근
+    piecestate_t *src = &game->board[from_y][from_x];
+    piecestate_t *dst = &game->board[to_y][to_x];
 
-    LOG_DEBUG("Target [%d][%d] (x,y): piece=%p, dead=%d",
-              to_x, to_y, (void *)dst_xy->piece, dst_xy->is_dead);
-    LOG_DEBUG("Target [%d][%d] (y,x): piece=%p, dead=%d",
-              to_y, to_x, (void *)dst_yx->piece, dst_yx->is_dead);
+    LOG_DEBUG("Source [%d][%d]: piece=0x%02x", from_y, from_x, *src);
+    LOG_DEBUG("Target [%d][%d]: piece=0x%02x", to_y, to_x, *dst);
 
     // 서버로부터 받은 이동은 이미 검증된 유효한 이동이므로 검증 없이 직접 적용
     // (클라이언트 상태와 서버 상태 간의 불일치로 인한 검증 실패를 방지)
-    //
-    // rule.c 수정 후: apply_move 함수는 (file, rank) = (x, y) 순서로 받음
-    apply_move(game, from_x, from_y, to_x, to_y);
+    apply_move(game, move);
 
     // 이동 후 보드 상태 확인
     LOG_DEBUG("After apply_move:");
-    LOG_DEBUG("Source [%d][%d] (x,y): piece=%p, dead=%d",
-              from_x, from_y, (void *)src_xy->piece, src_xy->is_dead);
-    LOG_DEBUG("Target [%d][%d] (x,y): piece=%p, dead=%d",
-              to_x, to_y, (void *)dst_xy->piece, dst_xy->is_dead);
+    LOG_DEBUG("Source [%d][%d]: piece=0x%02x", from_y, from_x, *src);
+    LOG_DEBUG("Target [%d][%d]: piece=0x%02x", to_y, to_x, *dst);
     LOG_DEBUG("=== MOVE DEBUG END ===");
 
     // PGN 기록은 move.c에서 처리 (중복 방지)
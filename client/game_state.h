@@ -5,6 +5,7 @@
 #include <stdint.h>
 #include <time.h>
 
+#include "move.h"
 #include "piece.h"
 #include "rule.h"  // game_t 사용을 위해 추가
 #include "types.h"
@@ -14,7 +15,6 @@
 #define MAX_MESSAGE_LENGTH 256
 
 #define MAX_PGN_MOVES  512
-#define MAX_COORD_STR  6
 #define MAX_RESULT_STR 8
 
 // 채팅 메시지 구조체
@@ -56,9 +56,9 @@ typedef struct
     bool white_in_check;
     bool black_in_check;
 
-    char pgn_moves[MAX_PGN_MOVES][MAX_COORD_STR];
-    int  pgn_move_count;
-    char pgn_result[MAX_RESULT_STR];
+    move_t pgn_moves[MAX_PGN_MOVES];
+    int    pgn_move_count;
+    char   pgn_result[MAX_RESULT_STR];
 } game_state_t;
 
 extern game_state_t *g_game_state;
@@ -79,7 +79,7 @@ bool        game_is_white_player(const game_state_t *state);
 const char *get_opponent_name(const game_state_t *state);
 
 // 서버 동기화 함수
-bool apply_move_from_server(game_t *game, const char *from, const char *to);
+bool apply_move_from_server(game_t *game, move_t move);
 
 // 타이머 관련 함수
 void update_game_timer(game_state_t *state);
@@ -0,0 +1,79 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../client_state.h"
+#include "config.h"
+#include "handlers.h"
+#include "logger.h"
+#include "search.h"
+
+// 채팅 창에 보여 줄 블런더 최대 개수
+#define ANALYSIS_MAX_BLUNDER_LINES 5
+
+// 백 기준 센티폰을 "+1.3" 또는 메이트면 "#"로 표기
+static void format_eval(int cp, char *out, size_t size) {
+    if (cp >= SCORE_MATE_MIN || cp <= -SCORE_MATE_MIN) {
+        snprintf(out, size, "%s#", cp > 0 ? "+" : "-");
+    } else {
+        snprintf(out, size, "%+.1f", cp / 100.0);
+    }
+}
+
+// 게임 분석 결과 처리 (블런더 요약을 채팅 창에 표시)
+int handle_analyze_game_response(ServerMessage *msg) {
+    if (msg->msg_case != SERVER_MESSAGE__MSG_ANALYZE_GAME_RES || !msg->analyze_game_res) {
+        return -1;
+    }
+
+    AnalyzeGameResponse *res = msg->analyze_game_res;
+    char                 line[DEFAULT_CHAT_MESSAGE_LENGTH];
+
+    if (!res->success) {
+        LOG_WARN("Game analysis failed: %s", res->message ? res->message : "(no message)");
+        snprintf(line, sizeof(line), "Analysis unavailable: %s", res->message ? res->message : "unknown error");
+        add_chat_message_safe("Analysis", line);
+        return 0;
+    }
+
+    int white_blunders = 0, black_blunders = 0;
+    for (size_t i = 0; i < res->n_moves; i++) {
+        if (!res->moves[i]->blunder)
+            continue;
+        if (res->moves[i]->ply % 2 == 0)
+            white_blunders++;
+        else
+            black_blunders++;
+    }
+
+    LOG_INFO("Game analysis received: %zu plies, depth=%d, blunders white=%d black=%d",
+             res->n_moves, res->depth, white_blunders, black_blunders);
+
+    snprintf(line, sizeof(line), "%zu moves analyzed (depth %d): White %d blunder(s), Black %d blunder(s)",
+             res->n_moves, res->depth, white_blunders, black_blunders);
+    add_chat_message_safe("Analysis", line);
+
+    // 블런더마다 "12... e7e5 (best d7d5) +0.3 -> -2.1" 형식으로 표시
+    int shown = 0;
+    for (size_t i = 0; i < res->n_moves && shown < ANALYSIS_MAX_BLUNDER_LINES; i++) {
+        MoveAnalysis *ma = res->moves[i];
+        if (!ma->blunder)
+            continue;
+
+        char before[16], after[16];
+        format_eval(ma->eval_before, before, sizeof(before));
+        format_eval(ma->eval_after, after, sizeof(after));
+        snprintf(line, sizeof(line), "%d%s %s (best %s) %s -> %s",
+                 ma->ply / 2 + 1, ma->ply % 2 == 0 ? "." : "...", ma->move, ma->best_move, before, after);
+        add_chat_message_safe("Analysis", line);
+        shown++;
+    }
+
+    // 채팅 창 갱신
+    client_state_t *client = get_client_state();
+    pthread_mutex_lock(&screen_mutex);
+    client->screen_update_requested = true;
+    pthread_mutex_unlock(&screen_mutex);
+
+    return 0;
+}
@@ -50,6 +50,9 @@ int dispatch_server_message(ServerMessage *msg) {
         case SERVER_MESSAGE__MSG_RESIGN_BROADCAST:
             return handle_resign_broadcast(msg);
 
+        case SERVER_MESSAGE__MSG_ANALYZE_GAME_RES:
+            return handle_analyze_game_response(msg);
+
         default:
             LOG_WARN("Unknown server message type: %d", msg->msg_case);
             add_chat_message_safe("System", "Unknown server message");
@@ -19,6 +19,7 @@ int handle_move_broadcast(ServerMessage *msg);
 int handle_check_broadcast(ServerMessage *msg);
 int handle_resign_response(ServerMessage *msg);
 int handle_resign_broadcast(ServerMessage *msg);
+int handle_analyze_game_response(ServerMessage *msg);
 
 // 메인 핸들러 디스패처
 int dispatch_server_message(ServerMessage *msg);
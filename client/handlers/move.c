@@ -3,38 +3,15 @@
 #include <string.h>
 #include <time.h>
 
+#include "../client_network.h"
 #include "../client_state.h"
 #include "../game_save.h"   // save_current_game 함수를 위해 추가
 #include "../game_state.h"  // apply_move_from_server 함수를 위해 추가
 #include "../ui/ui.h"       // show_dialog 함수를 위해 추가
 #include "handlers.h"
 #include "logger.h"
-
-// 체스 좌표를 배열 인덱스로 변환 (예: "a1" -> (0, 0))
-bool parse_chess_coordinate_client(const char *coord, int *x, int *y) {
-    if (!coord || strlen(coord) != 2) {
-        return false;
-    }
-
-    char file = coord[0];  // a-h
-    char rank = coord[1];  // 1-8
-
-    if (file < 'a' || file > 'h' || rank < '1' || rank > '8') {
-        return false;
-    }
-
-    *x = file - 'a';  // 0-7
-    *y = rank - '1';  // 0-7
-
-    return true;
-}
-
-// 배열 인덱스를 체스 좌표로 변환 (예: (0, 0) -> "a1")
-void format_chess_coordinate_client(int x, int y, char *coord) {
-    coord[0] = 'a' + x;
-    coord[1] = '1' + y;
-    coord[2] = '\0';
-}
+#include "move.h"
+#include "protocol_utils.h"
 
 // 서버로부터 받은 이동 결과 처리
 int handle_move_response(ServerMessage *msg) {
@@ -102,13 +79,22 @@ int handle_move_broadcast(ServerMessage *msg) {
              broadcast->to ? broadcast->to : "?");
     add_chat_message_safe("Game", chat_msg);
 
-    // 게임 보드 상태 업데이트
-    if (broadcast->from && broadcast->to) {
+    // 게임 보드 상태 업데이트 (좌표 문자열은 여기서 한 번만 파싱)
+    move_t move = MOVE_NONE;
+    if (broadcast->from && broadcast->to && move_parse_squares(broadcast->from, broadcast->to, &move)) {
         client_state_t *client = get_client_state();
 
+        // 프로모션 기물 반영 (PGN에도 e7e8n처럼 기록된다)
+        if (broadcast->promotion != PIECE_TYPE__PT_NONE) {
+            piece_type_t promotion = proto_to_piece_type(broadcast->promotion);
+            LOG_INFO("Piece promoted to: %d", promotion);
+            move = move_make_flag(move_from_x(move), move_from_y(move), move_to_x(move), move_to_y(move),
+                                  MOVE_FLAG_PROMOTION, promotion);
+        }
+
         LOG_DEBUG("Applying move from server: %s -> %s", broadcast->from, broadcast->to);
 
-        if (apply_move_from_server(&client->game_state.game, broadcast->from, broadcast->to)) {
+        if (apply_move_from_server(&client->game_state.game, move)) {
             LOG_DEBUG("Board updated successfully: %s -> %s", broadcast->from, broadcast->to);
 
             // PGN 형식으로 이동 기록 - 각 이동은 한 번만 기록
@@ -117,17 +103,14 @@ int handle_move_broadcast(ServerMessage *msg) {
                 // 이미 같은 이동이 기록되어 있는지 확인
                 bool already_recorded = false;
                 if (client->game_state.pgn_move_count > 0) {
-                    char move_str[MAX_COORD_STR];
-                    snprintf(move_str, sizeof(move_str), "%s%s", broadcast->from, broadcast->to);
-                    char *last_move = client->game_state.pgn_moves[client->game_state.pgn_move_count - 1];
-                    if (strcmp(last_move, move_str) == 0) {
+                    move_t last_move = client->game_state.pgn_moves[client->game_state.pgn_move_count - 1];
+                    if (last_move == move) {
                         already_recorded = true;
                     }
                 }
 
                 if (!already_recorded) {
-                    snprintf(client->game_state.pgn_moves[client->game_state.pgn_move_count],
-                             MAX_COORD_STR, "%s%s", broadcast->from, broadcast->to);
+                    client->game_state.pgn_moves[client->game_state.pgn_move_count] = move;
                     client->game_state.pgn_move_count++;
                     LOG_DEBUG("Recorded move %d: %s%s", client->game_state.pgn_move_count, broadcast->from, broadcast->to);
                 }
@@ -176,18 +159,12 @@ int handle_move_broadcast(ServerMessage *msg) {
             add_chat_message_safe("System", "Failed to update board state - invalid move coordinates");
         }
     } else {
-        LOG_WARN("Move broadcast missing coordinates: from=%s, to=%s",
+        LOG_WARN("Move broadcast missing or invalid coordinates: from=%s, to=%s",
                  broadcast->from ? broadcast->from : "NULL",
                  broadcast->to ? broadcast->to : "NULL");
         add_chat_message_safe("System", "Invalid move data received from server");
     }
 
-    // 프로모션 처리
-    if (broadcast->promotion != PIECE_TYPE__PT_NONE) {
-        LOG_INFO("Piece promoted to: %d", broadcast->promotion);
-        // TODO: 프로모션 처리
-    }
-
     // 게임 종료 처리
     if (broadcast->game_ends) {
         LOG_INFO("Game ended: type=%d, winner=%d", broadcast->end_type, broadcast->winner_team);
@@ -238,6 +215,9 @@ int handle_move_broadcast(ServerMessage *msg) {
         client_state_t *client_save = get_client_state();
         save_current_game(&client_save->game_state);
 
+        // 끝난 게임 분석 요청 (결과는 나중에 채팅 창으로 온다)
+        send_analyze_request(client_save->game_state.pgn_moves, client_save->game_state.pgn_move_count);
+
         // 게임 상태를 종료 상태로 설정 및 다이얼로그 플래그 설정
         client_state_t *client_end = get_client_state();
         pthread_mutex_lock(&screen_mutex);
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "../client_network.h"
 #include "../client_state.h"
 #include "../game_save.h"
 #include "handlers.h"
@@ -77,6 +78,9 @@ int handle_resign_broadcast(ServerMessage *msg) {
     // PGN 파일로 저장 (game_in_progress가 true인 상태에서)
     save_current_game(&client->game_state);
 
+    // 끝난 게임 분석 요청 (결과는 나중에 채팅 창으로 온다)
+    send_analyze_request(client->game_state.pgn_moves, client->game_state.pgn_move_count);
+
     // 게임 종료 상태 설정
     client->game_state.game_in_progress = false;
 
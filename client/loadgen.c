@@ -0,0 +1,912 @@
+// loadgen.c
+// 서버 부하 생성기
+//
+// 단일 스레드 epoll 루프에서 연결 N개를 열어 실제 클라이언트처럼 매칭을 요청하고,
+// 공용 규칙 엔진(common/rule.c)으로 고른 무작위 합법 수를 생각 시간을 두고 둔다.
+// 자기 차례마다 일정 확률로 채팅, 기권, 연결 끊기를 섞고, 게임이 끝나면 다시 매칭을 요청한다.
+// 매초 진행 상황을, 끝나면 처리량과 요청 종류별 지연 분위수를 출력한다.
+//
+// 사용법:
+//   loadgen [-h <host>] [-p <port>] [-n <connections>] [-r <connects/sec>] [-d <seconds>]
+//           [-t <think ms>] [-c <chat %>] [-R <resign %>] [-x <disconnect %>] [-s <seed>]
+//
+// -d 0 이면 Ctrl+C까지 돈다. 확률(%)은 자기 차례 한 번마다 적용한다.
+#include <arpa/inet.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <protobuf-c/protobuf-c.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "message.pb-c.h"
+#include "metrics.h"
+#include "protocol_utils.h"
+#include "rule.h"
+#include "utils.h"
+
+#define LOADGEN_MAX_EVENTS       256
+#define LOADGEN_MAX_FRAME        (1024 * 1024)  // 이보다 큰 프레임은 프로토콜 오류로 본다
+#define LOADGEN_READ_CHUNK       4096
+#define LOADGEN_RECONNECT_MS     1000  // 끊긴 연결을 다시 여는 간격
+#define LOADGEN_REMATCH_RETRY_MS 1000  // 매칭이 거절된(ErrorResponse) 뒤 다시 요청하는 간격
+#define LOADGEN_CHAT_INFLIGHT    4     // 연결당 지연을 재는 채팅 수 (넘치면 재지 않는다)
+#define LOADGEN_REPORT_NS        1000000000ull
+
+typedef enum {
+    PLAYER_IDLE,        // 연결 없음 (연결 타이머 대기)
+    PLAYER_CONNECTING,  // 비차단 connect 진행 중
+    PLAYER_MATCHING,    // 매칭을 요청하고 상대를 기다리는 중
+    PLAYER_PLAYING,     // 게임 중
+    PLAYER_FINISHED     // 게임이 끝나고 다음 매칭 타이머 대기
+} player_state_t;
+
+typedef enum {
+    TIMER_CONNECT,
+    TIMER_MATCH,
+    TIMER_MOVE
+} timer_action_t;
+
+typedef enum {
+    LATENCY_CONNECT,  // connect 시작 → 연결 완료
+    LATENCY_MATCH,    // MatchGameRequest → 첫 MatchGameResponse
+    LATENCY_PAIRING,  // MatchGameRequest → 게임 시작 (상대를 기다린 시간 포함)
+    LATENCY_MOVE,     // MoveRequest → MoveResponse
+    LATENCY_CHAT,     // ChatRequest → 자기 ChatBroadcast
+    LATENCY_COUNT
+} latency_kind_t;
+
+static const char *const latency_names[LATENCY_COUNT] = {"connect", "match", "pairing", "move", "chat"};
+
+typedef struct {
+    uint8_t *data;
+    size_t   len;
+    size_t   cap;
+} byte_buf_t;
+
+typedef struct {
+    int            index;
+    int            fd;  // -1이면 연결 없음
+    player_state_t state;
+    char           player_id[MAX_PLAYER_NAME_LENGTH];
+    team_t         team;
+    game_t         game;  // MoveBroadcast로만 갱신하는 로컬 국면
+    byte_buf_t     in;
+    byte_buf_t     out;
+    bool           want_write;  // EPOLLOUT 등록 여부
+
+    uint64_t connect_ns;  // 0이면 기다리는 응답 없음
+    uint64_t match_ns;
+    uint64_t pairing_ns;
+    uint64_t move_ns;
+    uint64_t chat_ns[LOADGEN_CHAT_INFLIGHT];
+    int      chat_head;
+    int      chat_count;
+
+    uint32_t       timer_gen;  // 타이머를 새로 걸면 증가 (힙에 남은 옛 타이머는 무시된다)
+    timer_action_t timer_action;
+} player_t;
+
+// 최소 힙 타이머 (연결당 하나만 살아 있고, 세대가 어긋난 항목은 꺼낼 때 버린다)
+typedef struct {
+    uint64_t due_ns;
+    uint32_t gen;
+    int      player;
+} loadgen_timer_t;
+
+typedef struct {
+    const char *host;
+    int         port;
+    int         connections;
+    double      connect_rate;  // 초당 새 연결 수 (처음 램프업)
+    int         duration_sec;
+    int         think_ms;      // 실제 생각 시간은 0.5~1.5배 사이에서 고른다
+    double      chat_pct;
+    double      resign_pct;
+    double      disconnect_pct;
+    uint64_t    seed;
+} loadgen_options_t;
+
+static loadgen_options_t g_opts = {
+    .host           = DEFAULT_SERVER_HOST,
+    .port           = DEFAULT_SERVER_PORT,
+    .connections    = 100,
+    .connect_rate   = 200.0,
+    .duration_sec   = 30,
+    .think_ms       = 500,
+    .chat_pct       = 5.0,
+    .resign_pct     = 0.5,
+    .disconnect_pct = 0.2,
+    .seed           = 0,
+};
+
+static struct {
+    uint64_t connects;
+    uint64_t connect_failures;
+    uint64_t server_closes;  // 서버가 끊었거나 송수신 오류
+    uint64_t dropped;        // -x 확률로 직접 끊은 횟수
+    uint64_t games_started;  // 연결 기준 (한 게임에 두 번 셀 수 있다)
+    uint64_t games_finished;
+    uint64_t moves;
+    uint64_t rejected_moves;
+    uint64_t desyncs;  // 브로드캐스트 수를 로컬 국면에 둘 수 없음
+    uint64_t chats;
+    uint64_t resigns;
+    uint64_t errors;  // ErrorResponse와 해석할 수 없는 프레임
+    uint64_t frames_sent;
+    uint64_t frames_received;
+    uint64_t bytes_sent;
+    uint64_t bytes_received;
+    int      open;     // 연결 완료 상태인 연결 수
+    int      playing;  // 게임 중인 연결 수
+
+    metric_hdr_t latency[LATENCY_COUNT];
+} g_stats;
+
+static player_t               *g_players;
+static loadgen_timer_t        *g_timers;
+static int                     g_timer_count;
+static int                     g_timer_cap;
+static int                     g_epfd = -1;
+static struct sockaddr_storage g_addr;
+static socklen_t               g_addr_len;
+static uint64_t                g_rng;
+
+static volatile sig_atomic_t g_stop = 0;
+
+static void handle_signal(int sig) {
+    (void)sig;
+    g_stop = 1;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// xorshift64* (재현 가능한 부하를 위해 -s로 시드를 고정할 수 있다)
+static uint64_t rng_next(void) {
+    g_rng ^= g_rng >> 12;
+    g_rng ^= g_rng << 25;
+    g_rng ^= g_rng >> 27;
+    return g_rng * 0x2545F4914F6CDD1Dull;
+}
+
+static bool rng_percent(double pct) {
+    return pct > 0 && (double)(rng_next() % 1000000) < pct * 10000.0;
+}
+
+// 생각 시간 (think_ms의 0.5~1.5배, 나노초)
+static uint64_t think_delay_ns(void) {
+    uint64_t base = (uint64_t)g_opts.think_ms * 1000000ull;
+    return base / 2 + (base ? rng_next() % (base + 1) : 0);
+}
+
+// ---------------------------------------------------------------------------
+// 타이머
+// ---------------------------------------------------------------------------
+
+static void timer_swap(int a, int b) {
+    loadgen_timer_t tmp = g_timers[a];
+    g_timers[a]         = g_timers[b];
+    g_timers[b]         = tmp;
+}
+
+static void timer_schedule(player_t *p, timer_action_t action, uint64_t delay_ns) {
+    if (g_timer_count == g_timer_cap) {
+        int              cap    = g_timer_cap ? g_timer_cap * 2 : 256;
+        loadgen_timer_t *timers = realloc(g_timers, (size_t)cap * sizeof(loadgen_timer_t));
+        if (!timers) {
+            perror("realloc");
+            exit(EXIT_FAILURE);
+        }
+        g_timers    = timers;
+        g_timer_cap = cap;
+    }
+
+    p->timer_action = action;
+    p->timer_gen++;
+
+    int i       = g_timer_count++;
+    g_timers[i] = (loadgen_timer_t){now_ns() + delay_ns, p->timer_gen, p->index};
+    while (i > 0 && g_timers[(i - 1) / 2].due_ns > g_timers[i].due_ns) {
+        timer_swap(i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+// 힙 맨 위 타이머를 꺼낸다
+static loadgen_timer_t timer_pop(void) {
+    loadgen_timer_t top = g_timers[0];
+    g_timers[0]         = g_timers[--g_timer_count];
+
+    int i = 0;
+    for (;;) {
+        int smallest = i;
+        int left     = 2 * i + 1;
+        int right    = left + 1;
+        if (left < g_timer_count && g_timers[left].due_ns < g_timers[smallest].due_ns)
+            smallest = left;
+        if (right < g_timer_count && g_timers[right].due_ns < g_timers[smallest].due_ns)
+            smallest = right;
+        if (smallest == i)
+            break;
+        timer_swap(i, smallest);
+        i = smallest;
+    }
+    return top;
+}
+
+// 걸려 있는 타이머를 무효로 만든다
+static void timer_cancel(player_t *p) {
+    p->timer_gen++;
+}
+
+// ---------------------------------------------------------------------------
+// 송수신
+// ---------------------------------------------------------------------------
+
+static bool buf_reserve(byte_buf_t *buf, size_t need) {
+    if (need <= buf->cap)
+        return true;
+    size_t cap = buf->cap ? buf->cap : LOADGEN_READ_CHUNK;
+    while (cap < need)
+        cap *= 2;
+    uint8_t *data = realloc(buf->data, cap);
+    if (!data)
+        return false;
+    buf->data = data;
+    buf->cap  = cap;
+    return true;
+}
+
+static void player_set_events(player_t *p, bool want_write) {
+    if (p->want_write == want_write)
+        return;
+    struct epoll_event ev;
+    ev.events   = EPOLLIN | (want_write ? EPOLLOUT : 0);
+    ev.data.ptr = p;
+    epoll_ctl(g_epfd, EPOLL_CTL_MOD, p->fd, &ev);
+    p->want_write = want_write;
+}
+
+// 연결을 닫고 일정 시간 뒤 다시 열도록 예약한다
+static void player_drop(player_t *p, bool by_server) {
+    if (p->fd < 0)
+        return;
+    if (by_server)
+        g_stats.server_closes++;
+    if (p->state != PLAYER_CONNECTING)
+        g_stats.open--;
+    if (p->state == PLAYER_PLAYING)
+        g_stats.playing--;
+
+    epoll_ctl(g_epfd, EPOLL_CTL_DEL, p->fd, NULL);
+    close(p->fd);
+    p->fd         = -1;
+    p->state      = PLAYER_IDLE;
+    p->in.len     = 0;
+    p->out.len    = 0;
+    p->want_write = false;
+    p->connect_ns = p->match_ns = p->pairing_ns = p->move_ns = 0;
+    p->chat_count = 0;
+
+    if (!g_stop)
+        timer_schedule(p, TIMER_CONNECT, LOADGEN_RECONNECT_MS * 1000000ull);
+    else
+        timer_cancel(p);
+}
+
+// 출력 버퍼를 가능한 만큼 보낸다 (남으면 EPOLLOUT을 기다린다), 실패하면 연결을 닫고 false
+static bool player_flush(player_t *p) {
+    size_t done = 0;
+    while (done < p->out.len) {
+        ssize_t n = send(p->fd, p->out.data + done, p->out.len - done, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            player_drop(p, true);
+            return false;
+        }
+        done += (size_t)n;
+        g_stats.bytes_sent += (uint64_t)n;
+    }
+    if (done > 0) {
+        memmove(p->out.data, p->out.data + done, p->out.len - done);
+        p->out.len -= done;
+    }
+    player_set_events(p, p->out.len > 0);
+    return true;
+}
+
+// 길이 접두어(4바이트, 네트워크 바이트 순서) 프레임으로 보낸다
+static bool player_send(player_t *p, ClientMessage *msg) {
+    size_t packed_len = client_message__get_packed_size(msg);
+    if (!buf_reserve(&p->out, p->out.len + 4 + packed_len)) {
+        player_drop(p, true);
+        return false;
+    }
+    uint32_t netlen = htonl((uint32_t)packed_len);
+    memcpy(p->out.data + p->out.len, &netlen, 4);
+    client_message__pack(msg, p->out.data + p->out.len + 4);
+    p->out.len += 4 + packed_len;
+    g_stats.frames_sent++;
+
+    // EPOLLOUT을 기다리는 중이면 이벤트 루프가 마저 보낸다
+    return p->want_write ? true : player_flush(p);
+}
+
+// ---------------------------------------------------------------------------
+// 클라이언트 동작
+// ---------------------------------------------------------------------------
+
+static void player_connect(player_t *p) {
+    int fd = socket(g_addr.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        g_stats.connect_failures++;
+        timer_schedule(p, TIMER_CONNECT, LOADGEN_RECONNECT_MS * 1000000ull);
+        return;
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    p->connect_ns = now_ns();
+    if (connect(fd, (struct sockaddr *)&g_addr, g_addr_len) < 0 && errno != EINPROGRESS) {
+        close(fd);
+        g_stats.connect_failures++;
+        timer_schedule(p, TIMER_CONNECT, LOADGEN_RECONNECT_MS * 1000000ull);
+        return;
+    }
+
+    // 연결 완료는 EPOLLOUT으로 알 수 있다
+    struct epoll_event ev;
+    ev.events   = EPOLLOUT;
+    ev.data.ptr = p;
+    if (epoll_ctl(g_epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        close(fd);
+        g_stats.connect_failures++;
+        timer_schedule(p, TIMER_CONNECT, LOADGEN_RECONNECT_MS * 1000000ull);
+        return;
+    }
+    p->fd         = fd;
+    p->state      = PLAYER_CONNECTING;
+    p->want_write = true;
+}
+
+static void player_request_match(player_t *p) {
+    MatchGameRequest match = MATCH_GAME_REQUEST__INIT;
+    match.player_id        = p->player_id;
+
+    ClientMessage msg = CLIENT_MESSAGE__INIT;
+    msg.msg_case      = CLIENT_MESSAGE__MSG_MATCH_GAME;
+    msg.match_game    = &match;
+
+    p->state      = PLAYER_MATCHING;
+    p->match_ns   = now_ns();
+    p->pairing_ns = p->match_ns;
+    player_send(p, &msg);
+}
+
+static void player_finish_connect(player_t *p) {
+    int       err = 0;
+    socklen_t len = sizeof(err);
+    if (getsockopt(p->fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err != 0) {
+        epoll_ctl(g_epfd, EPOLL_CTL_DEL, p->fd, NULL);
+        close(p->fd);
+        p->fd    = -1;
+        p->state = PLAYER_IDLE;
+        g_stats.connect_failures++;
+        timer_schedule(p, TIMER_CONNECT, LOADGEN_RECONNECT_MS * 1000000ull);
+        return;
+    }
+
+    metric_hdr_record(&g_stats.latency[LATENCY_CONNECT], now_ns() - p->connect_ns);
+    p->connect_ns = 0;
+    g_stats.connects++;
+    g_stats.open++;
+
+    p->want_write = true;
+    player_set_events(p, false);
+    player_request_match(p);
+}
+
+static void player_send_chat(player_t *p) {
+    char text[64];
+    snprintf(text, sizeof(text), "load chat %" PRIu64, g_stats.chats);
+
+    ChatRequest chat = CHAT_REQUEST__INIT;
+    chat.message     = text;
+
+    ClientMessage msg = CLIENT_MESSAGE__INIT;
+    msg.msg_case      = CLIENT_MESSAGE__MSG_CHAT;
+    msg.chat          = &chat;
+
+    if (p->chat_count < LOADGEN_CHAT_INFLIGHT) {
+        p->chat_ns[(p->chat_head + p->chat_count) % LOADGEN_CHAT_INFLIGHT] = now_ns();
+        p->chat_count++;
+    }
+    g_stats.chats++;
+    player_send(p, &msg);
+}
+
+static void player_resign(player_t *p) {
+    ResignRequest resign = RESIGN_REQUEST__INIT;
+    resign.player_id     = p->player_id;
+
+    ClientMessage msg = CLIENT_MESSAGE__INIT;
+    msg.msg_case      = CLIENT_MESSAGE__MSG_RESIGN;
+    msg.resign        = &resign;
+
+    g_stats.resigns++;
+    player_send(p, &msg);
+}
+
+// 자기 차례 타이머: 끊기/기권/수 두기 중 하나를 고르고, 수를 두면 채팅을 곁들일 수 있다
+static void player_take_turn(player_t *p) {
+    if (p->state != PLAYER_PLAYING || p->game.side_to_move != p->team || p->move_ns)
+        return;
+
+    if (rng_percent(g_opts.disconnect_pct)) {
+        g_stats.dropped++;
+        player_drop(p, false);
+        return;
+    }
+    if (rng_percent(g_opts.resign_pct)) {
+        player_resign(p);
+        return;
+    }
+
+    move_t moves[MAX_LEGAL_MOVES];
+    int    count = generate_legal_moves(&p->game, moves);
+    if (count == 0)
+        return;  // 메이트/스테일메이트는 서버가 MoveBroadcast로 알려 준다
+    move_t m = moves[rng_next() % (uint64_t)count];
+
+    char from[3], to[3];
+    square_format(move_from_x(m), move_from_y(m), from);
+    square_format(move_to_x(m), move_to_y(m), to);
+
+    MoveRequest move = MOVE_REQUEST__INIT;
+    move.from        = from;
+    move.to          = to;
+    if (move_flag(m) == MOVE_FLAG_PROMOTION)
+        move.promotion = piece_type_to_proto(move_promotion(m));
+
+    ClientMessage msg = CLIENT_MESSAGE__INIT;
+    msg.msg_case      = CLIENT_MESSAGE__MSG_MOVE;
+    msg.move          = &move;
+
+    p->move_ns = now_ns();
+    g_stats.moves++;
+    if (!player_send(p, &msg))
+        return;
+
+    if (rng_percent(g_opts.chat_pct))
+        player_send_chat(p);
+}
+
+static void player_schedule_turn(player_t *p) {
+    if (p->game.side_to_move == p->team)
+        timer_schedule(p, TIMER_MOVE, think_delay_ns());
+}
+
+static void player_game_over(player_t *p) {
+    if (p->state != PLAYER_PLAYING)
+        return;
+    g_stats.games_finished++;
+    g_stats.playing--;
+    p->state   = PLAYER_FINISHED;
+    p->move_ns = 0;
+    timer_schedule(p, TIMER_MATCH, think_delay_ns());
+}
+
+// 브로드캐스트된 수를 로컬 국면의 합법 수에서 찾는다 (없으면 false)
+static bool find_broadcast_move(const game_t *G, const MoveBroadcast *mb, move_t *out) {
+    int fx, fy, tx, ty;
+    if (!mb->from || !mb->to || !square_parse(mb->from, &fx, &fy) || !square_parse(mb->to, &tx, &ty))
+        return false;
+
+    // 프로모션 기물이 없으면 퀸으로 본다 (서버와 같은 기본값)
+    piece_type_t promotion = mb->promotion != PIECE_TYPE__PT_NONE ? proto_to_piece_type(mb->promotion) : PIECE_QUEEN;
+
+    move_t moves[MAX_LEGAL_MOVES];
+    int    count = generate_legal_moves(G, moves);
+    for (int i = 0; i < count; i++) {
+        move_t m = moves[i];
+        if (move_from_x(m) != fx || move_from_y(m) != fy || move_to_x(m) != tx || move_to_y(m) != ty)
+            continue;
+        if (move_flag(m) == MOVE_FLAG_PROMOTION && move_promotion(m) != promotion)
+            continue;
+        *out = m;
+        return true;
+    }
+    return false;
+}
+
+static void handle_match_response(player_t *p, const MatchGameResponse *res) {
+    uint64_t now = now_ns();
+    if (p->match_ns) {
+        metric_hdr_record(&g_stats.latency[LATENCY_MATCH], now - p->match_ns);
+        p->match_ns = 0;
+    }
+    if (p->state != PLAYER_MATCHING || !res->success || !res->game_id || res->game_id[0] == '\0' ||
+        res->assigned_team == TEAM__TEAM_UNSPECIFIED)
+        return;  // "Waiting for opponent..." 응답
+
+    if (p->pairing_ns) {
+        metric_hdr_record(&g_stats.latency[LATENCY_PAIRING], now - p->pairing_ns);
+        p->pairing_ns = 0;
+    }
+    init_startpos(&p->game);
+    p->team  = proto_to_team(res->assigned_team);
+    p->state = PLAYER_PLAYING;
+    g_stats.games_started++;
+    g_stats.playing++;
+    player_schedule_turn(p);
+}
+
+static void handle_move_broadcast(player_t *p, const MoveBroadcast *mb) {
+    if (p->state != PLAYER_PLAYING)
+        return;
+
+    move_t m;
+    if (!find_broadcast_move(&p->game, mb, &m)) {
+        // 로컬 국면이 서버와 어긋났다, 기권하고 새 게임으로 맞춘다
+        g_stats.desyncs++;
+        if (!mb->game_ends)
+            player_resign(p);
+        else
+            player_game_over(p);
+        return;
+    }
+    apply_move(&p->game, m);
+
+    if (mb->game_ends)
+        player_game_over(p);
+    else
+        player_schedule_turn(p);
+}
+
+static void handle_server_message(player_t *p, const ServerMessage *msg) {
+    switch (msg->msg_case) {
+        case SERVER_MESSAGE__MSG_MATCH_GAME_RES:
+            handle_match_response(p, msg->match_game_res);
+            break;
+        case SERVER_MESSAGE__MSG_MOVE_RES:
+            if (p->move_ns) {
+                metric_hdr_record(&g_stats.latency[LATENCY_MOVE], now_ns() - p->move_ns);
+                p->move_ns = 0;
+            }
+            if (!msg->move_res->success) {
+                g_stats.rejected_moves++;
+                if (p->state == PLAYER_PLAYING)
+                    player_resign(p);
+            }
+            break;
+        case SERVER_MESSAGE__MSG_MOVE_BROADCAST:
+            handle_move_broadcast(p, msg->move_broadcast);
+            break;
+        case SERVER_MESSAGE__MSG_CHAT_BROADCAST:
+            if (p->chat_count > 0 && msg->chat_broadcast->player_id &&
+                strcmp(msg->chat_broadcast->player_id, p->player_id) == 0) {
+                metric_hdr_record(&g_stats.latency[LATENCY_CHAT], now_ns() - p->chat_ns[p->chat_head]);
+                p->chat_head = (p->chat_head + 1) % LOADGEN_CHAT_INFLIGHT;
+                p->chat_count--;
+            }
+            break;
+        case SERVER_MESSAGE__MSG_RESIGN_BROADCAST:
+        case SERVER_MESSAGE__MSG_GAME_END:
+            player_game_over(p);
+            break;
+        case SERVER_MESSAGE__MSG_ERROR:
+            g_stats.errors++;
+            // 매칭이 거절되면 (대기열 가득 참, 서버 드레인 등) 잠시 뒤 다시 요청한다
+            if (p->state == PLAYER_MATCHING) {
+                p->match_ns = p->pairing_ns = 0;
+                p->state                    = PLAYER_FINISHED;
+                timer_schedule(p, TIMER_MATCH, LOADGEN_REMATCH_RETRY_MS * 1000000ull);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// 읽을 수 있는 만큼 받아 완성된 프레임을 처리한다 (level-triggered라 한 번만 recv)
+static void player_read(player_t *p) {
+    if (!buf_reserve(&p->in, p->in.len + LOADGEN_READ_CHUNK)) {
+        player_drop(p, true);
+        return;
+    }
+    ssize_t n = recv(p->fd, p->in.data + p->in.len, p->in.cap - p->in.len, 0);
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+        player_drop(p, true);
+        return;
+    }
+    if (n < 0)
+        return;
+    p->in.len += (size_t)n;
+    g_stats.bytes_received += (uint64_t)n;
+
+    size_t offset = 0;
+    while (p->fd >= 0 && p->in.len - offset >= 4) {
+        uint32_t frame_len;
+        memcpy(&frame_len, p->in.data + offset, 4);
+        frame_len = ntohl(frame_len);
+        if (frame_len > LOADGEN_MAX_FRAME) {
+            g_stats.errors++;
+            player_drop(p, true);
+            return;
+        }
+        if (p->in.len - offset - 4 < frame_len)
+            break;
+
+        ServerMessage *msg = server_message__unpack(NULL, frame_len, p->in.data + offset + 4);
+        offset += 4 + frame_len;
+        g_stats.frames_received++;
+        if (!msg) {
+            g_stats.errors++;
+            continue;
+        }
+        handle_server_message(p, msg);
+        server_message__free_unpacked(msg, NULL);
+    }
+
+    // 처리 중에 연결이 닫혔으면 버퍼는 이미 비워졌다
+    if (p->fd >= 0 && offset > 0) {
+        memmove(p->in.data, p->in.data + offset, p->in.len - offset);
+        p->in.len -= offset;
+    }
+}
+
+static void player_handle_event(player_t *p, uint32_t events) {
+    if (p->fd < 0)
+        return;
+    if (p->state == PLAYER_CONNECTING) {
+        player_finish_connect(p);
+        return;
+    }
+    if (events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+        player_read(p);
+    if (p->fd >= 0 && (events & EPOLLOUT))
+        player_flush(p);
+}
+
+static void run_timer(const loadgen_timer_t *t) {
+    player_t *p = &g_players[t->player];
+    if (t->gen != p->timer_gen)
+        return;
+
+    switch (p->timer_action) {
+        case TIMER_CONNECT:
+            if (p->fd < 0)
+                player_connect(p);
+            break;
+        case TIMER_MATCH:
+            if (p->fd >= 0 && p->state == PLAYER_FINISHED)
+                player_request_match(p);
+            break;
+        case TIMER_MOVE:
+            player_take_turn(p);
+            break;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 보고
+// ---------------------------------------------------------------------------
+
+static void print_progress(double elapsed, uint64_t prev_moves, uint64_t prev_frames, double interval) {
+    printf("[%6.1fs] conns %d/%d playing %d | moves %.0f/s frames %.0f/s | games %" PRIu64 " | errors %" PRIu64 "\n",
+           elapsed, g_stats.open, g_opts.connections, g_stats.playing,
+           (double)(g_stats.moves - prev_moves) / interval,
+           (double)(g_stats.frames_sent + g_stats.frames_received - prev_frames) / interval,
+           g_stats.games_finished, g_stats.errors + g_stats.rejected_moves + g_stats.desyncs);
+    fflush(stdout);
+}
+
+static void print_report(double elapsed) {
+    double secs = elapsed > 0 ? elapsed : 1;
+
+    printf("\n=== loadgen report (%.1fs, %d connections) ===\n", elapsed, g_opts.connections);
+    printf("Connections: %" PRIu64 " opened, %" PRIu64 " failed, %" PRIu64 " closed by server, %" PRIu64 " dropped\n",
+           g_stats.connects, g_stats.connect_failures, g_stats.server_closes, g_stats.dropped);
+    printf("Games:       %" PRIu64 " started, %" PRIu64 " finished (per connection)\n",
+           g_stats.games_started, g_stats.games_finished);
+    printf("Moves:       %" PRIu64 " (%.1f/s), %" PRIu64 " rejected, %" PRIu64 " desync\n",
+           g_stats.moves, (double)g_stats.moves / secs, g_stats.rejected_moves, g_stats.desyncs);
+    printf("Chats:       %" PRIu64 ", resigns %" PRIu64 ", errors %" PRIu64 "\n",
+           g_stats.chats, g_stats.resigns, g_stats.errors);
+    printf("Frames:      %" PRIu64 " sent (%.1f/s), %" PRIu64 " received (%.1f/s)\n",
+           g_stats.frames_sent, (double)g_stats.frames_sent / secs,
+           g_stats.frames_received, (double)g_stats.frames_received / secs);
+    printf("Bytes:       %" PRIu64 " sent, %" PRIu64 " received\n", g_stats.bytes_sent, g_stats.bytes_received);
+
+    printf("\nLatency (ms)      count       p50       p90       p99     p99.9       max\n");
+    for (int k = 0; k < LATENCY_COUNT; k++) {
+        metric_hdr_t *h = &g_stats.latency[k];
+        printf("%-10s %12llu %9.3f %9.3f %9.3f %9.3f %9.3f\n", latency_names[k],
+               (unsigned long long)atomic_load(&h->count),
+               metric_hdr_quantile(h, 0.5) / 1e6, metric_hdr_quantile(h, 0.9) / 1e6,
+               metric_hdr_quantile(h, 0.99) / 1e6, metric_hdr_quantile(h, 0.999) / 1e6,
+               (double)atomic_load(&h->max_ns) / 1e6);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+            "Usage: %s [-h <host>] [-p <port>] [-n <connections>] [-r <connects/sec>] [-d <seconds>]\n"
+            "       %*s [-t <think ms>] [-c <chat %%>] [-R <resign %%>] [-x <disconnect %%>] [-s <seed>]\n",
+            prog, (int)strlen(prog), "");
+}
+
+// 연결 수만큼 fd를 쓸 수 있게 소프트 한도를 하드 한도까지 올린다
+static void raise_fd_limit(void) {
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < rl.rlim_max) {
+        rl.rlim_cur = rl.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &rl);
+    }
+}
+
+static bool resolve_server(void) {
+    char port[16];
+    snprintf(port, sizeof(port), "%d", g_opts.port);
+
+    struct addrinfo hints = {0};
+    hints.ai_family       = AF_UNSPEC;
+    hints.ai_socktype     = SOCK_STREAM;
+
+    struct addrinfo *res = NULL;
+    int              rc  = getaddrinfo(g_opts.host, port, &hints, &res);
+    if (rc != 0) {
+        fprintf(stderr, "Cannot resolve %s: %s\n", g_opts.host, gai_strerror(rc));
+        return false;
+    }
+    memcpy(&g_addr, res->ai_addr, res->ai_addrlen);
+    g_addr_len = res->ai_addrlen;
+    freeaddrinfo(res);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-h") == 0 && i + 1 < argc) {
+            g_opts.host = argv[++i];
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            g_opts.port = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            g_opts.connections = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            g_opts.connect_rate = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            g_opts.duration_sec = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            g_opts.think_ms = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            g_opts.chat_pct = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-R") == 0 && i + 1 < argc) {
+            g_opts.resign_pct = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-x") == 0 && i + 1 < argc) {
+            g_opts.disconnect_pct = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            g_opts.seed = strtoull(argv[++i], NULL, 10);
+        } else {
+            print_usage(argv[0]);
+            return 2;
+        }
+    }
+    if (g_opts.connections < 1 || g_opts.port <= 0 || g_opts.port > 65535 || g_opts.think_ms < 0 ||
+        g_opts.duration_sec < 0 || g_opts.connect_rate <= 0) {
+        print_usage(argv[0]);
+        return 2;
+    }
+    if (!resolve_server())
+        return 1;
+
+    g_rng = g_opts.seed ? g_opts.seed : (now_ns() ^ (uint64_t)getpid());
+    if (!g_rng)
+        g_rng = 1;
+
+    raise_fd_limit();
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, handle_signal);
+    signal(SIGTERM, handle_signal);
+
+    g_epfd    = epoll_create1(EPOLL_CLOEXEC);
+    g_players = calloc((size_t)g_opts.connections, sizeof(player_t));
+    if (g_epfd < 0 || !g_players) {
+        perror("loadgen init");
+        return 1;
+    }
+
+    // 연결은 -r 속도로 나눠 연다 (한꺼번에 열면 accept 백로그가 넘친다)
+    uint64_t ramp_step = (uint64_t)(1e9 / g_opts.connect_rate);
+    for (int i = 0; i < g_opts.connections; i++) {
+        player_t *p = &g_players[i];
+        p->index    = i;
+        p->fd       = -1;
+        snprintf(p->player_id, sizeof(p->player_id), "load-%d", i);
+        timer_schedule(p, TIMER_CONNECT, (uint64_t)i * ramp_step);
+    }
+
+    printf("loadgen: %d connections to %s:%d, think %dms, chat %.2f%%, resign %.2f%%, disconnect %.2f%%, seed %" PRIu64 "\n",
+           g_opts.connections, g_opts.host, g_opts.port, g_opts.think_ms, g_opts.chat_pct, g_opts.resign_pct,
+           g_opts.disconnect_pct, g_opts.seed);
+
+    uint64_t start       = now_ns();
+    uint64_t end         = g_opts.duration_sec ? start + (uint64_t)g_opts.duration_sec * 1000000000ull : UINT64_MAX;
+    uint64_t next_report = start + LOADGEN_REPORT_NS;
+    uint64_t last_report = start;
+    uint64_t prev_moves  = 0;
+    uint64_t prev_frames = 0;
+
+    struct epoll_event events[LOADGEN_MAX_EVENTS];
+    while (!g_stop) {
+        uint64_t now = now_ns();
+        if (now >= end)
+            break;
+
+        while (g_timer_count > 0 && g_timers[0].due_ns <= now) {
+            loadgen_timer_t t = timer_pop();
+            run_timer(&t);
+        }
+
+        if (now >= next_report) {
+            print_progress((double)(now - start) / 1e9, prev_moves, prev_frames, (double)(now - last_report) / 1e9);
+            prev_moves  = g_stats.moves;
+            prev_frames = g_stats.frames_sent + g_stats.frames_received;
+            last_report = now;
+            next_report += LOADGEN_REPORT_NS;
+        }
+
+        // 다음 타이머, 보고, 종료 중 가장 이른 시각까지 기다린다
+        uint64_t wake = next_report < end ? next_report : end;
+        if (g_timer_count > 0 && g_timers[0].due_ns < wake)
+            wake = g_timers[0].due_ns;
+        int timeout = wake > now ? (int)((wake - now + 999999) / 1000000) : 0;
+
+        int n = epoll_wait(g_epfd, events, LOADGEN_MAX_EVENTS, timeout);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("epoll_wait");
+            break;
+        }
+        for (int i = 0; i < n; i++)
+            player_handle_event(events[i].data.ptr, events[i].events);
+    }
+
+    double elapsed = (double)(now_ns() - start) / 1e9;
+    g_stop         = 1;  // 이제부터 닫는 연결은 다시 열지 않는다
+    for (int i = 0; i < g_opts.connections; i++) {
+        player_drop(&g_players[i], false);
+        free(g_players[i].in.data);
+        free(g_players[i].out.data);
+    }
+    print_report(elapsed);
+
+    close(g_epfd);
+    free(g_players);
+    free(g_timers);
+    return 0;
+}
@@ -31,10 +31,12 @@ int write_pgn(const char* filename, game_state_t* state) {
 
     // LAN(예: e2e4) 형식의 수 출력
     for (int i = 0; i < state->pgn_move_count; ++i) {
+        char move_str[MOVE_STR_LEN];
+        move_format(state->pgn_moves[i], move_str);
         if (i % 2 == 0)
-            fprintf(fp, "%d. %s", i / 2 + 1, state->pgn_moves[i]);
+            fprintf(fp, "%d. %s", i / 2 + 1, move_str);
         else
-            fprintf(fp, " %s\n", state->pgn_moves[i]);
+            fprintf(fp, " %s\n", move_str);
     }
     if (state->pgn_move_count % 2 != 0)
         fprintf(fp, "\n");
@@ -13,24 +13,25 @@
 
 #include "game_state.h"  // apply_move_from_server(), reset_game_to_starting_position()
 #include "logger.h"      // LOG_ERROR, LOG_DEBUG
+#include "move.h"        // move_t, move_parse(), move_format()
+#include "rule.h"        // validate_game()
 #include "ui/ui.h"       // draw_current_screen()
 
 // 외부에서 정의된 종료 요청 플래그 (main.c에서)
 extern volatile sig_atomic_t shutdown_requested;
 
 #define MAX_MOVES 512
-#define MAX_SAN   16
 
 typedef struct {
-    char           moves[MAX_MOVES][MAX_SAN];
+    move_t         moves[MAX_MOVES];
     int            move_count;
     int            current_move;
     bool           auto_play;
     struct timeval last_auto_play_time;
 } replay_state_t;
 
-// PGN 파일에서 수(token)만 추출
-static int load_moves(const char* filename, char moves[][MAX_SAN]) {
+// PGN 파일에서 수(token)만 추출해 move_t로 변환 (로드 시 한 번만 파싱)
+static int load_moves(const char* filename, move_t moves[]) {
     FILE* fp = fopen(filename, "r");
     if (!fp) return 0;
     char line[512];
@@ -43,11 +44,18 @@ static int load_moves(const char* filename, char moves[][MAX_SAN]) {
     while (fscanf(fp, "%31s", token) == 1 && count < MAX_MOVES) {
         // "1." 같은 수번호 토큰 무시
         if (strchr(token, '.') != NULL) continue;
-        strncpy(moves[count], token, MAX_SAN - 1);
-        moves[count][MAX_SAN - 1] = '\0';
+        // 결과 표기("1-0", "*") 등 좌표 표기가 아닌 토큰 무시
+        if (!move_parse(token, &moves[count])) continue;
         count++;
     }
     fclose(fp);
+
+    // 수 목록 전체를 한 번에 검증하고, 불법 수가 있으면 그 직전까지만 재생
+    validate_result_t result;
+    if (!validate_game(moves, (size_t)count, &result)) {
+        LOG_WARN("load_moves(): illegal move at ply %zu in %s, truncating", result.illegal_ply, filename);
+        count = (int)result.illegal_ply;
+    }
     return count;
 }
 
@@ -97,10 +105,13 @@ static void draw_replay_screen(replay_state_t* state) {
             wattron(moves_win, A_REVERSE);
         }
 
+        char move_str[MOVE_STR_LEN];
+        move_format(state->moves[move_idx], move_str);
+
         if (is_white) {
-            mvwprintw(moves_win, i + 1, 2, "%3d. %-8s", move_num, state->moves[move_idx]);
+            mvwprintw(moves_win, i + 1, 2, "%3d. %-8s", move_num, move_str);
         } else {
-            mvwprintw(moves_win, i + 1, 17, "%-8s", state->moves[move_idx]);
+            mvwprintw(moves_win, i + 1, 17, "%-8s", move_str);
         }
 
         if (move_idx == state->current_move) {
@@ -132,11 +143,7 @@ static void replay_to_move(replay_state_t* state, int target_move) {
     reset_game_to_starting_position(&g_game_state->game);
 
     for (int i = 0; i <= target_move && i < state->move_count; i++) {
-        if (strlen(state->moves[i]) >= 4) {
-            char from[3] = {state->moves[i][0], state->moves[i][1], '\0'};
-            char to[3]   = {state->moves[i][2], state->moves[i][3], '\0'};
-            apply_move_from_server(&g_game_state->game, from, to);
-        }
+        apply_move_from_server(&g_game_state->game, state->moves[i]);
     }
 }
 
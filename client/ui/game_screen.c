@@ -8,13 +8,13 @@
 #include "ui.h"
 
 // 체스 말 유니코드 문자 반환
-const char *get_piece_unicode(piece_t *piece, team_t team) {
-    if (!piece)
+const char *get_piece_unicode(piecestate_t piece) {
+    if (piece_is_empty(piece))
         return " ";
 
     // 흰색 팀 (0) - 흰색 유니코드, 검은색 팀 (1) - 검은색 유니코드
-    if (team == TEAM_WHITE) {  // 흰색
-        switch (piece->type) {
+    if (piece_team(piece) == TEAM_WHITE) {  // 흰색
+        switch (piece_type(piece)) {
             case PIECE_KING:
                 return "W KNG";
             case PIECE_QUEEN:
@@ -29,7 +29,7 @@ const char *get_piece_unicode(piece_t *piece, team_t team) {
                 return "W PAW";
         }
     } else {  // 검은색
-        switch (piece->type) {
+        switch (piece_type(piece)) {
             case PIECE_KING:
                 return "B KNG";
             case PIECE_QUEEN:
@@ -64,8 +64,8 @@ void calculate_possible_moves(game_state_t *game_state, int selected_x, int sele
     int sy = selected_y;
 
     // 선택된 위치에 기물이 있는지 확인
-    piecestate_t *selected_piece = &game->board[sy][sx];
-    if (!selected_piece->piece || selected_piece->is_dead) {
+    piecestate_t selected_piece = game->board[sy][sx];
+    if (piece_is_empty(selected_piece)) {
         return;
     }
 
@@ -77,12 +77,11 @@ void calculate_possible_moves(game_state_t *game_state, int selected_x, int sele
             }
 
             // common/rule.c의 is_move_legal 함수 사용
-            if (is_move_legal(game, sx, sy, dx, dy)) {
-                piecestate_t *target_piece = &game->board[dy][dx];
+            if (is_move_legal(game, move_make(sx, sy, dx, dy))) {
+                piecestate_t target_piece = game->board[dy][dx];
 
                 // 목표 위치에 상대 기물이 있으면 캡처 가능 위치로 표시
-                if (target_piece->piece && !target_piece->is_dead &&
-                    target_piece->team != selected_piece->team) {
+                if (piece_is_team(target_piece, 1 - piece_team(selected_piece))) {
                     game_state->capture_moves[dy][dx] = true;
                 } else {
                     game_state->possible_moves[dy][dx] = true;
@@ -141,8 +140,10 @@ void draw_chess_board(WINDOW *board_win) {
             // 체크메이트/체크 상태 킹 확인 (실제 좌표 사용)
             bool          is_check_king     = false;
             bool          is_checkmate_king = false;
-            piecestate_t *piece             = &game->board[actual_row][actual_col];
-            if (piece->piece && !piece->is_dead && piece->piece->type == PIECE_KING) {
+            piecestate_t  piece             = game->board[actual_row][actual_col];
+            if (!piece_is_empty(piece) && piece_type(piece) == PIECE_KING) {
+                team_t king_team = piece_team(piece);
+
                 // rule.h의 함수들을 직접 사용해서 체크/체크메이트 상태 확인
                 bool white_in_check    = is_in_check(game, TEAM_WHITE);
                 bool black_in_check    = is_in_check(game, TEAM_BLACK);
@@ -151,14 +152,14 @@ void draw_chess_board(WINDOW *board_win) {
                 // 체크메이트 상황에서 체크메이트당한 킹 확인
                 if (is_game_checkmate) {
                     // 체크메이트는 현재 차례인 팀이 당한 것이므로
-                    if ((piece->team == game->side_to_move && white_in_check && piece->team == TEAM_WHITE) ||
-                        (piece->team == game->side_to_move && black_in_check && piece->team == TEAM_BLACK)) {
+                    if ((king_team == game->side_to_move && white_in_check && king_team == TEAM_WHITE) ||
+                        (king_team == game->side_to_move && black_in_check && king_team == TEAM_BLACK)) {
                         is_checkmate_king = true;
                     }
                 } else {
                     // 일반 체크 상황
-                    if ((piece->team == TEAM_WHITE && white_in_check) ||
-                        (piece->team == TEAM_BLACK && black_in_check)) {
+                    if ((king_team == TEAM_WHITE && white_in_check) ||
+                        (king_team == TEAM_BLACK && black_in_check)) {
                         is_check_king = true;
                     }
                 }
@@ -185,12 +186,11 @@ void draw_chess_board(WINDOW *board_win) {
             }
             // 3줄로 한 칸 출력
             mvwprintw(board_win, y, x, "       ");
-            if (piece->piece && !piece->is_dead) {
-                const char *piece_unicode = get_piece_unicode(piece->piece, piece->team);
+            if (!piece_is_empty(piece)) {
+                const char *piece_unicode = get_piece_unicode(piece);
 
                 // 기물이 내 기물인지 상대방 기물인지 판단
-                team_t piece_team  = piece->team;
-                bool   is_my_piece = (piece_team == client->game_state.local_team);
+                bool is_my_piece = (piece_team(piece) == client->game_state.local_team);
 
                 if (is_my_piece) {
                     // 내 기물: 볼드 속성만 추가 (배경색은 기존 칸 색상 유지)
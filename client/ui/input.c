@@ -4,6 +4,7 @@
 #include "../client_network.h"  // send_move_request 함수를 위해 변경
 #include "../client_state.h"
 #include "../logger.h"
+#include "move.h"
 #include "piece.h"
 #include "ui.h"
 
@@ -104,10 +105,10 @@ void handle_board_click(int board_x, int board_y) {
 
     if (!client->piece_selected) {
         // 기물 선택 - 경계 검사 후 배열 접근
-        piecestate_t *piece = &game->board[board_y][board_x];
-        if (piece->piece && !piece->is_dead) {
+        piecestate_t piece = game->board[board_y][board_x];
+        if (!piece_is_empty(piece)) {
             // 현재 플레이어의 기물인지 확인
-            team_t piece_team = piece->team;
+            team_t owner = piece_team(piece);
 
             // 현재 턴인지 확인
             if (game->side_to_move != client->game_state.local_team) {
@@ -120,7 +121,7 @@ void handle_board_click(int board_x, int board_y) {
             }
 
             // 자신의 기물인지 확인
-            if (piece_team != client->game_state.local_team) {
+            if (owner != client->game_state.local_team) {
                 pthread_mutex_unlock(&screen_mutex);
                 add_chat_message_safe("System", "That's not your piece!");
                 return;
@@ -171,7 +172,8 @@ void handle_board_click(int board_x, int board_y) {
             pthread_mutex_unlock(&screen_mutex);
 
             // 서버로 이동 요청 전송
-            if (send_move_request(from_coord, to_coord) == 0) {
+            // 마우스 이동은 항상 퀸으로 프로모션
+            if (send_move_request(from_coord, to_coord, PIECE_QUEEN) == 0) {
                 // 뮤텍스 다시 잠금하여 상태 변경
                 pthread_mutex_lock(&screen_mutex);
                 client->piece_selected = false;
@@ -344,8 +346,9 @@ bool handle_chess_notation(const char *notation) {
         return false;
     }
 
-    if (strlen(notation) == 4) {
-        // e2e4 형식
+    size_t len = strlen(notation);
+    if (len == 4 || len == 5) {
+        // e2e4 형식 (프로모션은 e7e8n처럼 기물 문자를 붙인다)
         if (client->current_screen == SCREEN_GAME) {
             // 체스 표기법을 좌표로 변환
             int from_x = notation[0] - 'a';
@@ -360,13 +363,24 @@ bool handle_chess_notation(const char *notation) {
                 return false;
             }
 
+            // 프로모션 기물 (생략 시 퀸)
+            piece_type_t promotion = PIECE_QUEEN;
+            if (len == 5) {
+                move_t parsed;
+                if (!move_parse(notation, &parsed)) {
+                    add_chat_message_safe("System", "Invalid promotion piece (use n, b, r or q)");
+                    return false;
+                }
+                promotion = move_promotion(parsed);
+            }
+
             game_t *game = &client->game_state.game;
 
             // 기물 확인
-            piecestate_t *piece = &game->board[from_y][from_x];
+            piecestate_t piece = game->board[from_y][from_x];
 
             // 기물이 있는지 확인
-            if (!piece->piece || piece->is_dead) {
+            if (piece_is_empty(piece)) {
                 add_chat_message_safe("System", "No piece at source position");
                 return false;
             }
@@ -386,14 +400,14 @@ bool handle_chess_notation(const char *notation) {
             to_coord[1]   = notation[3];
             to_coord[2]   = '\0';
 
-            if (send_move_request(from_coord, to_coord) == 0) {
+            if (send_move_request(from_coord, to_coord, promotion) == 0) {
                 return true;
             } else {
                 add_chat_message_safe("System", "Failed to send move request.");
             }
         }
     } else {
-        add_chat_message_safe("System", "Use format: e2e4 (from-to)");
+        add_chat_message_safe("System", "Use format: e2e4 (from-to) or e7e8n (promotion)");
     }
 
     return false;
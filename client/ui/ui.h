@@ -59,7 +59,7 @@ bool handle_resign_dialog_input(int ch);
 void draw_chess_board(WINDOW *board_win);
 void draw_chat_area(WINDOW *chat_win);
 void draw_game_menu(WINDOW *menu_win);
-char get_piece_char(piece_t *piece, int team);
+char get_piece_char(piecestate_t piece);
 void calculate_possible_moves(game_state_t *game_state, int selected_x, int selected_y, bool piece_selected);
 
 // 입력 처리
@@ -0,0 +1,111 @@
+// book.c
+#include "book.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "utils.h"
+
+bool book_open(book_t *book, const char *path) {
+    memset(book, 0, sizeof(*book));
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(book_header_t)) {
+        close(fd);
+        return false;
+    }
+
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);  // 매핑은 fd를 닫아도 유지된다
+    if (map == MAP_FAILED)
+        return false;
+
+    // 헤더와 크기만 확인하고 항목은 건드리지 않는다 (필요한 페이지만 나중에 올라온다)
+    const book_header_t *hdr = map;
+    game_t               start;
+    init_startpos(&start);
+    if (hdr->magic != BOOK_MAGIC || hdr->version != BOOK_VERSION ||
+        hdr->start_hash != start.hash ||
+        (size_t)st.st_size != sizeof(book_header_t) + (size_t)hdr->count * sizeof(book_entry_t)) {
+        munmap(map, (size_t)st.st_size);
+        return false;
+    }
+
+    book->entries  = (const book_entry_t *)((const uint8_t *)map + sizeof(book_header_t));
+    book->count    = hdr->count;
+    book->map      = map;
+    book->map_size = (size_t)st.st_size;
+    return true;
+}
+
+void book_close(book_t *book) {
+    if (book->map)
+        munmap(book->map, book->map_size);
+    memset(book, 0, sizeof(*book));
+}
+
+size_t book_find(const book_t *book, uint64_t key, const book_entry_t **first) {
+    // lower bound: key 이상인 첫 항목
+    size_t lo = 0, hi = book->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (book->entries[mid].key < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    size_t end = lo;
+    while (end < book->count && book->entries[end].key == key)
+        end++;
+
+    *first = &book->entries[lo];
+    return end - lo;
+}
+
+move_t book_pick(const book_t *book, const game_t *G, uint64_t random) {
+    if (!book->entries)
+        return MOVE_NONE;
+
+    const book_entry_t *e;
+    size_t              n = book_find(book, G->hash, &e);
+    if (n == 0)
+        return MOVE_NONE;
+
+    // 해시 충돌 대비: 실제 합법 수인 항목만 후보로 둔다
+    move_t legal[MAX_LEGAL_MOVES];
+    int    legal_count = generate_legal_moves(G, legal);
+
+    uint32_t total = 0;
+    bool     ok[MAX_LEGAL_MOVES];
+    for (size_t i = 0; i < n && i < MAX_LEGAL_MOVES; i++) {
+        ok[i] = false;
+        for (int j = 0; j < legal_count; j++) {
+            if (legal[j] == e[i].move) {
+                ok[i] = e[i].weight > 0;
+                break;
+            }
+        }
+        if (ok[i])
+            total += e[i].weight;
+    }
+    if (total == 0)
+        return MOVE_NONE;
+
+    uint32_t r = (uint32_t)(random % total);
+    for (size_t i = 0; i < n && i < MAX_LEGAL_MOVES; i++) {
+        if (!ok[i])
+            continue;
+        if (r < e[i].weight)
+            return e[i].move;
+        r -= e[i].weight;
+    }
+    return MOVE_NONE;
+}
@@ -0,0 +1,55 @@
+// book.h
+#ifndef COMMON_BOOK_H
+#define COMMON_BOOK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "move.h"
+#include "rule.h"
+
+// 오프닝 북 파일 형식 (리틀 엔디언, 파싱 없이 mmap한 그대로 조회)
+//   book_header_t
+//   book_entry_t[count]  (key 오름차순, 같은 key 안에서는 weight 내림차순)
+#define BOOK_MAGIC   0x314b4f4f42535343ULL  // "CSSBOOK1"
+#define BOOK_VERSION 1
+
+typedef struct {
+    uint64_t magic;       // BOOK_MAGIC
+    uint32_t version;     // BOOK_VERSION
+    uint32_t count;       // 항목 수
+    uint64_t start_hash;  // 시작 국면 해시 (Zobrist 키가 다르게 생성된 빌드의 북은 거절)
+} book_header_t;
+
+// 국면 하나에서 둘 수 있는 북 수 하나 (16바이트)
+typedef struct {
+    uint64_t key;       // 국면 해시 (game_t.hash)
+    move_t   move;      // 생성기 플래그까지 포함한 수
+    uint16_t weight;    // 선택 가중치 (원본 기보에서 나온 횟수)
+    uint32_t reserved;  // 0
+} book_entry_t;
+
+_Static_assert(sizeof(book_header_t) == 24, "book header layout");
+_Static_assert(sizeof(book_entry_t) == 16, "book entry layout");
+
+// 열린 북 (읽기 전용 매핑이므로 여러 스레드가 잠금 없이 공유)
+typedef struct {
+    const book_entry_t *entries;
+    size_t              count;
+    void               *map;
+    size_t              map_size;
+} book_t;
+
+// path를 읽기 전용으로 mmap하고 헤더만 확인 (실패 시 false, book은 빈 상태)
+bool book_open(book_t *book, const char *path);
+void book_close(book_t *book);
+
+// key에 해당하는 항목들을 이진 탐색으로 찾아 *first에 두고 개수를 반환 (없으면 0)
+size_t book_find(const book_t *book, uint64_t key, const book_entry_t **first);
+
+// G에서 둘 북 수를 가중치에 따라 고른다 (random은 호출자가 주는 난수)
+// 북에 없거나 해시 충돌로 합법 수가 아니면 MOVE_NONE
+move_t book_pick(const book_t *book, const game_t *G, uint64_t random);
+
+#endif  // COMMON_BOOK_H
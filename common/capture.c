@@ -0,0 +1,199 @@
+#include "capture.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "logger.h"
+
+#define CAPTURE_BUFFER_SIZE    (64 * 1024)   // 모아서 쓰는 단위
+#define CAPTURE_FLUSH_INTERVAL 1000000000ll  // 이보다 오래 버퍼에 머문 레코드는 다음 기록 때 내보낸다 (나노초)
+
+static struct {
+    int       fd;        // -1이면 꺼짐
+    uint32_t *conn_ids;  // 소켓 fd → 연결 번호 (0이면 모르는 연결)
+    int       conn_cap;
+    uint32_t  next_conn_id;
+    uint64_t  frames;
+    uint64_t  bytes;
+    int64_t   last_flush_ns;
+    size_t    len;
+    uint8_t   buf[CAPTURE_BUFFER_SIZE];
+} g_capture = {.fd = -1};
+
+static int64_t clock_ns(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (int64_t)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+// 쓰기에 실패하면 캡처를 끈다 (서버 동작에는 영향을 주지 않는다)
+static void capture_disable(const char *reason) {
+    LOG_WARN("Traffic capture disabled: %s", reason);
+    close(g_capture.fd);
+    g_capture.fd  = -1;
+    g_capture.len = 0;
+}
+
+static bool write_fully(const uint8_t *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(g_capture.fd, data, len);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static void capture_flush(int64_t now) {
+    if (g_capture.len > 0 && !write_fully(g_capture.buf, g_capture.len)) {
+        capture_disable(strerror(errno));
+        return;
+    }
+    g_capture.len           = 0;
+    g_capture.last_flush_ns = now;
+}
+
+static void capture_append(const void *data, size_t len) {
+    if (g_capture.fd < 0)
+        return;
+    if (g_capture.len + len > sizeof(g_capture.buf)) {
+        capture_flush(g_capture.last_flush_ns);
+        if (g_capture.fd < 0)
+            return;
+        // 버퍼보다 큰 본문은 바로 쓴다
+        if (len > sizeof(g_capture.buf)) {
+            if (!write_fully(data, len))
+                capture_disable(strerror(errno));
+            return;
+        }
+    }
+    memcpy(g_capture.buf + g_capture.len, data, len);
+    g_capture.len += len;
+}
+
+static void append_record(capture_rec_type_t type, uint32_t conn_id, int64_t now) {
+    capture_rec_header_t rec = {0};
+    rec.type                 = (uint8_t)type;
+    rec.conn_id              = conn_id;
+    rec.ts_ns                = now;
+    capture_append(&rec, sizeof(rec));
+}
+
+// 버퍼가 오래 머물렀으면 내보낸다 (서버가 죽어도 최근 1초 남짓만 잃는다)
+static void maybe_flush(int64_t now) {
+    if (g_capture.fd >= 0 && now - g_capture.last_flush_ns >= CAPTURE_FLUSH_INTERVAL)
+        capture_flush(now);
+}
+
+int capture_start(const char *path) {
+    if (!path)
+        return -1;
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        LOG_WARN("Failed to open capture file %s: %s", path, strerror(errno));
+        return -1;
+    }
+
+    capture_header_t header;
+    header.magic        = CAPTURE_MAGIC;
+    header.version      = CAPTURE_VERSION;
+    header.realtime_ns  = clock_ns(CLOCK_REALTIME);
+    header.monotonic_ns = clock_ns(CLOCK_MONOTONIC);
+
+    g_capture.fd            = fd;
+    g_capture.len           = 0;
+    g_capture.next_conn_id  = 0;
+    g_capture.frames        = 0;
+    g_capture.bytes         = 0;
+    g_capture.last_flush_ns = header.monotonic_ns;
+    capture_append(&header, sizeof(header));
+
+    LOG_INFO("Capturing inbound traffic to %s", path);
+    return 0;
+}
+
+bool capture_enabled(void) {
+    return g_capture.fd >= 0;
+}
+
+// fd에 붙은 연결 번호 (없으면 새로 붙이고 OPEN을 남긴다, 캡처 시작 전에 열린 연결도 여기서 잡힌다)
+static uint32_t connection_id(int fd, int64_t now) {
+    if (fd < 0)
+        return 0;
+    if (fd >= g_capture.conn_cap) {
+        int cap = g_capture.conn_cap ? g_capture.conn_cap : 64;
+        while (cap <= fd)
+            cap *= 2;
+        uint32_t *ids = realloc(g_capture.conn_ids, (size_t)cap * sizeof(uint32_t));
+        if (!ids)
+            return 0;
+        memset(ids + g_capture.conn_cap, 0, (size_t)(cap - g_capture.conn_cap) * sizeof(uint32_t));
+        g_capture.conn_ids = ids;
+        g_capture.conn_cap = cap;
+    }
+    if (g_capture.conn_ids[fd] == 0) {
+        g_capture.conn_ids[fd] = ++g_capture.next_conn_id;
+        append_record(CAPTURE_REC_OPEN, g_capture.conn_ids[fd], now);
+    }
+    return g_capture.conn_ids[fd];
+}
+
+void capture_connection_open(int fd) {
+    if (g_capture.fd < 0)
+        return;
+    int64_t now = clock_ns(CLOCK_MONOTONIC);
+    // 이전 연결이 종료 기록 없이 fd를 넘겼다면 새 번호를 붙인다
+    if (fd >= 0 && fd < g_capture.conn_cap)
+        g_capture.conn_ids[fd] = 0;
+    connection_id(fd, now);
+    maybe_flush(now);
+}
+
+void capture_connection_close(int fd) {
+    if (g_capture.fd < 0 || fd < 0 || fd >= g_capture.conn_cap || g_capture.conn_ids[fd] == 0)
+        return;
+    int64_t now = clock_ns(CLOCK_MONOTONIC);
+    append_record(CAPTURE_REC_CLOSE, g_capture.conn_ids[fd], now);
+    g_capture.conn_ids[fd] = 0;
+    maybe_flush(now);
+}
+
+void capture_frame(int fd, const uint8_t prefix[4], const uint8_t *body, uint32_t body_len) {
+    if (g_capture.fd < 0)
+        return;
+    int64_t  now     = clock_ns(CLOCK_MONOTONIC);
+    uint32_t conn_id = connection_id(fd, now);
+    if (conn_id == 0)
+        return;
+
+    append_record(CAPTURE_REC_FRAME, conn_id, now);
+    capture_append(prefix, 4);
+    capture_append(body, body_len);
+    g_capture.frames++;
+    g_capture.bytes += 4 + (uint64_t)body_len;
+    maybe_flush(now);
+}
+
+void capture_stop(void) {
+    if (g_capture.fd < 0)
+        return;
+    capture_flush(clock_ns(CLOCK_MONOTONIC));
+    if (g_capture.fd >= 0) {
+        LOG_INFO("Traffic capture closed: %llu frames, %llu bytes, %u connections",
+                 (unsigned long long)g_capture.frames, (unsigned long long)g_capture.bytes, g_capture.next_conn_id);
+        close(g_capture.fd);
+        g_capture.fd = -1;
+    }
+    free(g_capture.conn_ids);
+    g_capture.conn_ids = NULL;
+    g_capture.conn_cap = 0;
+}
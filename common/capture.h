@@ -0,0 +1,58 @@
+#ifndef COMMON_CAPTURE_H
+#define COMMON_CAPTURE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// 트래픽 캡처 파일 형식 (서버가 쓰고 capreplay가 읽는다)
+// 서버가 받은 ClientMessage 프레임을 받은 그대로 연결 번호, 시각과 함께 남긴다
+// 값은 쓴 호스트의 바이트 순서 그대로이며, 레코드는 정렬 없이 이어 붙는다
+//
+//   파일   = 헤더 레코드*
+//   레코드 = capture_rec_header_t 본문
+//
+// FRAME 본문은 네트워크에서 받은 바이트 그대로다 (4바이트 길이 접두어 + ClientMessage),
+// 따라서 본문 길이는 접두어에서 읽고, 재생 도구는 해석하지 않고 그대로 보낸다.
+
+#define CAPTURE_MAGIC   0x50414343u  // "CCAP"
+#define CAPTURE_VERSION 1
+
+// 파일 헤더: 레코드의 단조 시계 값을 벽시계로 바꾸기 위한 기준점
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    int64_t  realtime_ns;   // 캡처 시작 시각 (CLOCK_REALTIME)
+    int64_t  monotonic_ns;  // 같은 순간의 CLOCK_MONOTONIC
+} capture_header_t;
+
+typedef enum {
+    CAPTURE_REC_OPEN  = 1,  // 연결 수락 (본문 없음)
+    CAPTURE_REC_FRAME = 2,  // 본문: 길이 접두어 + ClientMessage
+    CAPTURE_REC_CLOSE = 3   // 연결 종료 (본문 없음)
+} capture_rec_type_t;
+
+// 레코드 머리 (16바이트)
+typedef struct {
+    uint8_t  type;
+    uint8_t  reserved[3];
+    uint32_t conn_id;  // 연결마다 1부터 새로 붙이는 번호 (fd 재사용과 무관)
+    int64_t  ts_ns;    // CLOCK_MONOTONIC
+} capture_rec_header_t;
+
+// 쓰기 API (이벤트 루프 스레드 전용, 캡처가 꺼져 있으면 분기 하나로 끝난다)
+
+// path에 캡처를 시작한다 (실패하면 -1, 서버는 캡처 없이 계속 동작)
+int  capture_start(const char *path);
+bool capture_enabled(void);
+
+// 연결 수락/종료 (fd가 닫히기 전에 호출)
+void capture_connection_open(int fd);
+void capture_connection_close(int fd);
+
+// 받은 프레임 한 개 (prefix는 받은 그대로의 4바이트 길이 접두어)
+void capture_frame(int fd, const uint8_t prefix[4], const uint8_t *body, uint32_t body_len);
+
+// 남은 버퍼를 쓰고 파일을 닫는다
+void capture_stop(void);
+
+#endif  // COMMON_CAPTURE_H
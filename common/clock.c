@@ -0,0 +1,102 @@
+#include "clock.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <string.h>
+
+// 캐시된 시각 (시각 값은 원자적으로, 타임스탬프 문자열은 seqlock으로 보호)
+static struct {
+    atomic_bool     ticked;    // 한 번이라도 clock_tick()이 불렸는지
+    atomic_llong    mono_ms;   // 단조 증가만 하도록 큰 값만 반영
+    atomic_llong    wall_ns;
+    atomic_uint     seq;       // 홀수면 문자열 갱신 중
+    atomic_llong    text_sec;  // text가 나타내는 초
+    char            text[CLOCK_TIMESTAMP_LEN];
+    pthread_mutex_t text_mutex;  // 문자열을 만드는 스레드는 하나만
+} g_clock = {.text_sec = -1, .text_mutex = PTHREAD_MUTEX_INITIALIZER};
+
+static int64_t timespec_ns(const struct timespec *ts) {
+    return (int64_t)ts->tv_sec * 1000000000LL + ts->tv_nsec;
+}
+
+// 다른 스레드가 더 늦은 시각을 이미 기록했으면 덮어쓰지 않는다
+static void store_max(atomic_llong *slot, int64_t value) {
+    long long cur = atomic_load_explicit(slot, memory_order_relaxed);
+    while (cur < value &&
+           !atomic_compare_exchange_weak_explicit(slot, &cur, value, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static void format_local(time_t sec, char out[CLOCK_TIMESTAMP_LEN]) {
+    struct tm local_time;
+    localtime_r(&sec, &local_time);
+    strftime(out, CLOCK_TIMESTAMP_LEN, "%Y-%m-%d %H:%M:%S", &local_time);
+}
+
+void clock_tick(void) {
+    struct timespec mono, wall;
+    clock_gettime(CLOCK_MONOTONIC, &mono);
+    clock_gettime(CLOCK_REALTIME, &wall);
+
+    store_max(&g_clock.mono_ms, timespec_ns(&mono) / 1000000);
+    store_max(&g_clock.wall_ns, timespec_ns(&wall));
+    atomic_store_explicit(&g_clock.ticked, true, memory_order_release);
+
+    // 초가 바뀌었을 때만 localtime_r을 부른다 (다른 스레드가 만드는 중이면 맡긴다)
+    if (wall.tv_sec != atomic_load_explicit(&g_clock.text_sec, memory_order_relaxed) &&
+        pthread_mutex_trylock(&g_clock.text_mutex) == 0) {
+        if (wall.tv_sec > atomic_load_explicit(&g_clock.text_sec, memory_order_relaxed)) {
+            char text[CLOCK_TIMESTAMP_LEN];
+            format_local(wall.tv_sec, text);
+
+            atomic_fetch_add_explicit(&g_clock.seq, 1, memory_order_acq_rel);
+            atomic_store_explicit(&g_clock.text_sec, wall.tv_sec, memory_order_relaxed);
+            memcpy(g_clock.text, text, sizeof(text));
+            atomic_fetch_add_explicit(&g_clock.seq, 1, memory_order_release);
+        }
+        pthread_mutex_unlock(&g_clock.text_mutex);
+    }
+}
+
+int64_t clock_now_ms(void) {
+    if (atomic_load_explicit(&g_clock.ticked, memory_order_acquire))
+        return atomic_load_explicit(&g_clock.mono_ms, memory_order_relaxed);
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+    return timespec_ns(&ts) / 1000000;
+}
+
+void clock_wall_timespec(struct timespec *ts) {
+    if (!atomic_load_explicit(&g_clock.ticked, memory_order_acquire)) {
+        clock_gettime(CLOCK_REALTIME_COARSE, ts);
+        return;
+    }
+    int64_t ns  = atomic_load_explicit(&g_clock.wall_ns, memory_order_relaxed);
+    ts->tv_sec  = (time_t)(ns / 1000000000LL);
+    ts->tv_nsec = (long)(ns % 1000000000LL);
+}
+
+int64_t clock_wall_ms(void) {
+    struct timespec ts;
+    clock_wall_timespec(&ts);
+    return timespec_ns(&ts) / 1000000;
+}
+
+time_t clock_wall_sec(void) {
+    struct timespec ts;
+    clock_wall_timespec(&ts);
+    return ts.tv_sec;
+}
+
+void clock_format_timestamp(time_t sec, char out[CLOCK_TIMESTAMP_LEN]) {
+    unsigned begin = atomic_load_explicit(&g_clock.seq, memory_order_acquire);
+    if ((begin & 1) == 0 && atomic_load_explicit(&g_clock.text_sec, memory_order_relaxed) == sec) {
+        memcpy(out, g_clock.text, CLOCK_TIMESTAMP_LEN);
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&g_clock.seq, memory_order_relaxed) == begin)
+            return;
+    }
+    format_local(sec, out);
+}
@@ -0,0 +1,29 @@
+#ifndef COMMON_CLOCK_H
+#define COMMON_CLOCK_H
+
+#include <stdint.h>
+#include <time.h>
+
+// 타임스탬프 문자열 버퍼 크기 ("YYYY-MM-DD HH:MM:SS" + NUL)
+#define CLOCK_TIMESTAMP_LEN 20
+
+// 거친 시계 (coarse clock)
+// 이벤트 루프 한 바퀴나 타이머 틱마다 clock_tick()으로 한 번 갱신하고, 핫 패스는 캐시된 값만 읽는다.
+// 아무도 갱신하지 않은 프로세스(클라이언트 등)에서는 *_COARSE 시계를 직접 읽는다.
+// 정밀도는 마지막 틱 시점까지이므로 탐색 시간 제한처럼 짧은 구간을 재는 곳에는 쓰지 않는다.
+
+// 현재 시각으로 캐시 갱신 (여러 스레드에서 불러도 된다, 초가 바뀌면 타임스탬프 문자열도 새로 만든다)
+void clock_tick(void);
+
+// 캐시된 CLOCK_MONOTONIC 밀리초 (경과 시간 계산용)
+int64_t clock_now_ms(void);
+
+// 캐시된 CLOCK_REALTIME
+int64_t clock_wall_ms(void);
+time_t  clock_wall_sec(void);
+void    clock_wall_timespec(struct timespec *ts);
+
+// sec 시각의 "YYYY-MM-DD HH:MM:SS" 문자열 (캐시된 초와 같으면 복사만 한다)
+void clock_format_timestamp(time_t sec, char out[CLOCK_TIMESTAMP_LEN]);
+
+#endif  // COMMON_CLOCK_H
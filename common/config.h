@@ -16,4 +16,34 @@
 #define DEFAULT_MAX_CHAT_MESSAGES   50
 #define DEFAULT_CHAT_MESSAGE_LENGTH 256
 
+// 봇 상대 설정 (서버)
+#define DEFAULT_BOT_MATCH_DELAY    30    // 초 단위, 이만큼 기다린 플레이어는 봇과 매칭 (0이면 끔)
+#define DEFAULT_BOT_THINK_TIME_MS  1000  // 수당 탐색 시간 (밀리초)
+#define DEFAULT_BOT_TT_SIZE_MB     16    // 워커당 치환표 크기
+
+// 오프닝 북 (서버, -k로 경로를 주지 않으면 서버 실행 파일과 같은 디렉터리에서 찾는다)
+#define DEFAULT_BOOK_FILE "book.bin"
+
+// 워커 풀 설정 (서버, 봇 탐색 등 CPU를 많이 쓰는 작업용)
+#define DEFAULT_WORKER_THREADS        2    // 워커 스레드 수
+#define DEFAULT_WORKER_QUEUE_CAPACITY 128  // 동시에 대기/실행 가능한 작업 수
+
+// 메트릭 엔드포인트 (서버, 127.0.0.1에서 GET /metrics, -m 0이면 끔)
+#define DEFAULT_METRICS_PORT 9080
+
+// 관리 소켓 (서버, Unix 도메인 소켓 경로, -a none이면 끔)
+#define DEFAULT_ADMIN_SOCKET "chess_server.sock"
+
+// 요청 트레이싱 (서버, 스레드마다 N번째 요청마다 하나씩 기록, -T 0이면 끔)
+#define DEFAULT_TRACE_SAMPLE_RATE 100
+
+// 게임 분석 설정 (서버, 끝난 게임의 수마다 얕게 탐색)
+#define DEFAULT_ANALYSIS_DEPTH        3    // 국면당 탐색 깊이
+#define DEFAULT_ANALYSIS_PLY_TIME_MS  20   // 국면당 탐색 시간 상한 (밀리초)
+#define DEFAULT_ANALYSIS_MAX_PLIES    512  // 한 번에 분석할 수 있는 최대 반수
+#define DEFAULT_ANALYSIS_BLUNDER_CP   200  // 둔 쪽이 이만큼 이상 잃으면 블런더 (센티폰)
+#define DEFAULT_ANALYSIS_COOLDOWN_SEC 10   // 같은 클라이언트의 요청 사이 최소 간격 (초)
+#define DEFAULT_ANALYSIS_MAX_INFLIGHT 1    // 워커에서 동시에 돌리는 분석 수 (봇 탐색 몫을 남긴다)
+#define DEFAULT_ANALYSIS_QUEUE_SIZE   16   // 차례를 기다릴 수 있는 분석 요청 수
+
 #endif  // COMMON_CONFIG_H
\ No newline at end of file
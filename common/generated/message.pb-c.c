@@ -367,6 +367,51 @@ void   chat_request__free_unpacked
   assert(message->base.descriptor == &chat_request__descriptor);
   protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
 }
+void   analyze_game_request__init
+                     (AnalyzeGameRequest         *message)
+{
+  static const AnalyzeGameRequest init_value = ANALYZE_GAME_REQUEST__INIT;
+  *message = init_value;
+}
+size_t analyze_game_request__get_packed_size
+                     (const AnalyzeGameRequest *message)
+{
+  assert(message->base.descriptor == &analyze_game_request__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t analyze_game_request__pack
+                     (const AnalyzeGameRequest *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &analyze_game_request__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t analyze_game_request__pack_to_buffer
+                     (const AnalyzeGameRequest *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &analyze_game_request__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+AnalyzeGameRequest *
+       analyze_game_request__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (AnalyzeGameRequest *)
+     protobuf_c_message_unpack (&analyze_game_request__descriptor,
+                                allocator, len, data);
+}
+void   analyze_game_request__free_unpacked
+                     (AnalyzeGameRequest *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &analyze_game_request__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
 void   server_message__init
                      (ServerMessage         *message)
 {
@@ -907,6 +952,96 @@ void   chat_broadcast__free_unpacked
   assert(message->base.descriptor == &chat_broadcast__descriptor);
   protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
 }
+void   move_analysis__init
+                     (MoveAnalysis         *message)
+{
+  static const MoveAnalysis init_value = MOVE_ANALYSIS__INIT;
+  *message = init_value;
+}
+size_t move_analysis__get_packed_size
+                     (const MoveAnalysis *message)
+{
+  assert(message->base.descriptor == &move_analysis__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t move_analysis__pack
+                     (const MoveAnalysis *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &move_analysis__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t move_analysis__pack_to_buffer
+                     (const MoveAnalysis *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &move_analysis__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+MoveAnalysis *
+       move_analysis__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (MoveAnalysis *)
+     protobuf_c_message_unpack (&move_analysis__descriptor,
+                                allocator, len, data);
+}
+void   move_analysis__free_unpacked
+                     (MoveAnalysis *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &move_analysis__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   analyze_game_response__init
+                     (AnalyzeGameResponse         *message)
+{
+  static const AnalyzeGameResponse init_value = ANALYZE_GAME_RESPONSE__INIT;
+  *message = init_value;
+}
+size_t analyze_game_response__get_packed_size
+                     (const AnalyzeGameResponse *message)
+{
+  assert(message->base.descriptor == &analyze_game_response__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t analyze_game_response__pack
+                     (const AnalyzeGameResponse *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &analyze_game_response__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t analyze_game_response__pack_to_buffer
+                     (const AnalyzeGameResponse *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &analyze_game_response__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+AnalyzeGameResponse *
+       analyze_game_response__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (AnalyzeGameResponse *)
+     protobuf_c_message_unpack (&analyze_game_response__descriptor,
+                                allocator, len, data);
+}
+void   analyze_game_response__free_unpacked
+                     (AnalyzeGameResponse *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &analyze_game_response__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
 void   error_response__init
                      (ErrorResponse         *message)
 {
@@ -952,7 +1087,7 @@ void   error_response__free_unpacked
   assert(message->base.descriptor == &error_response__descriptor);
   protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
 }
-static const ProtobufCFieldDescriptor client_message__field_descriptors[8] =
+static const ProtobufCFieldDescriptor client_message__field_descriptors[9] =
 {
   {
     "version",
@@ -1050,8 +1185,21 @@ static const ProtobufCFieldDescriptor client_message__field_descriptors[8] =
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+  {
+    "analyze_game",
+    25,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_MESSAGE,
+    offsetof(ClientMessage, msg_case),
+    offsetof(ClientMessage, analyze_game),
+    &analyze_game_request__descriptor,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
 };
 static const unsigned client_message__field_indices_by_name[] = {
+  8,   /* field[8] = analyze_game */
   4,   /* field[4] = cancel_match */
   7,   /* field[7] = chat */
   2,   /* field[2] = echo */
@@ -1066,7 +1214,7 @@ static const ProtobufCIntRange client_message__number_ranges[3 + 1] =
   { 1, 0 },
   { 10, 1 },
   { 20, 3 },
-  { 0, 8 }
+  { 0, 9 }
 };
 const ProtobufCMessageDescriptor client_message__descriptor =
 {
@@ -1076,7 +1224,7 @@ const ProtobufCMessageDescriptor client_message__descriptor =
   "ClientMessage",
   "",
   sizeof(ClientMessage),
-  8,
+  9,
   client_message__field_descriptors,
   client_message__field_indices_by_name,
   3,  client_message__number_ranges,
@@ -1248,7 +1396,7 @@ const ProtobufCMessageDescriptor cancel_match_request__descriptor =
   (ProtobufCMessageInit) cancel_match_request__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor move_request__field_descriptors[3] =
+static const ProtobufCFieldDescriptor move_request__field_descriptors[4] =
 {
   {
     "from",
@@ -1286,16 +1434,29 @@ static const ProtobufCFieldDescriptor move_request__field_descriptors[3] =
     0,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+  {
+    "promotion",
+    4,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_ENUM,
+    0,   /* quantifier_offset */
+    offsetof(MoveRequest, promotion),
+    &piece_type__descriptor,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
 };
 static const unsigned move_request__field_indices_by_name[] = {
   0,   /* field[0] = from */
+  3,   /* field[3] = promotion */
   2,   /* field[2] = timestamp */
   1,   /* field[1] = to */
 };
 static const ProtobufCIntRange move_request__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 3 }
+  { 0, 4 }
 };
 const ProtobufCMessageDescriptor move_request__descriptor =
 {
@@ -1305,7 +1466,7 @@ const ProtobufCMessageDescriptor move_request__descriptor =
   "MoveRequest",
   "",
   sizeof(MoveRequest),
-  3,
+  4,
   move_request__field_descriptors,
   move_request__field_indices_by_name,
   1,  move_request__number_ranges,
@@ -1401,7 +1562,58 @@ const ProtobufCMessageDescriptor chat_request__descriptor =
   (ProtobufCMessageInit) chat_request__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor server_message__field_descriptors[13] =
+static const ProtobufCFieldDescriptor analyze_game_request__field_descriptors[2] =
+{
+  {
+    "game_id",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    0,   /* quantifier_offset */
+    offsetof(AnalyzeGameRequest, game_id),
+    NULL,
+    &protobuf_c_empty_string,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "moves",
+    2,
+    PROTOBUF_C_LABEL_REPEATED,
+    PROTOBUF_C_TYPE_STRING,
+    offsetof(AnalyzeGameRequest, n_moves),
+    offsetof(AnalyzeGameRequest, moves),
+    NULL,
+    &protobuf_c_empty_string,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned analyze_game_request__field_indices_by_name[] = {
+  0,   /* field[0] = game_id */
+  1,   /* field[1] = moves */
+};
+static const ProtobufCIntRange analyze_game_request__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 2 }
+};
+const ProtobufCMessageDescriptor analyze_game_request__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "AnalyzeGameRequest",
+  "AnalyzeGameRequest",
+  "AnalyzeGameRequest",
+  "",
+  sizeof(AnalyzeGameRequest),
+  2,
+  analyze_game_request__field_descriptors,
+  analyze_game_request__field_indices_by_name,
+  1,  analyze_game_request__number_ranges,
+  (ProtobufCMessageInit) analyze_game_request__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor server_message__field_descriptors[14] =
 {
   {
     "version",
@@ -1547,6 +1759,18 @@ static const ProtobufCFieldDescriptor server_message__field_descriptors[13] =
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+  {
+    "analyze_game_res",
+    29,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_MESSAGE,
+    offsetof(ServerMessage, msg_case),
+    offsetof(ServerMessage, analyze_game_res),
+    &analyze_game_response__descriptor,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
   {
     "error",
     99,
@@ -1561,11 +1785,12 @@ static const ProtobufCFieldDescriptor server_message__field_descriptors[13] =
   },
 };
 static const unsigned server_message__field_indices_by_name[] = {
+  12,   /* field[12] = analyze_game_res */
   4,   /* field[4] = cancel_match_res */
   9,   /* field[9] = chat_broadcast */
   7,   /* field[7] = check_broadcast */
   2,   /* field[2] = echo_res */
-  12,   /* field[12] = error */
+  13,   /* field[13] = error */
   8,   /* field[8] = game_end */
   3,   /* field[3] = match_game_res */
   6,   /* field[6] = move_broadcast */
@@ -1580,8 +1805,8 @@ static const ProtobufCIntRange server_message__number_ranges[4 + 1] =
   { 1, 0 },
   { 10, 1 },
   { 20, 3 },
-  { 99, 12 },
-  { 0, 13 }
+  { 99, 13 },
+  { 0, 14 }
 };
 const ProtobufCMessageDescriptor server_message__descriptor =
 {
@@ -1591,7 +1816,7 @@ const ProtobufCMessageDescriptor server_message__descriptor =
   "ServerMessage",
   "",
   sizeof(ServerMessage),
-  13,
+  14,
   server_message__field_descriptors,
   server_message__field_indices_by_name,
   4,  server_message__number_ranges,
@@ -2588,6 +2813,199 @@ const ProtobufCMessageDescriptor chat_broadcast__descriptor =
   (ProtobufCMessageInit) chat_broadcast__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
+static const ProtobufCFieldDescriptor move_analysis__field_descriptors[6] =
+{
+  {
+    "ply",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_INT32,
+    0,   /* quantifier_offset */
+    offsetof(MoveAnalysis, ply),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "move",
+    2,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    0,   /* quantifier_offset */
+    offsetof(MoveAnalysis, move),
+    NULL,
+    &protobuf_c_empty_string,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "best_move",
+    3,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    0,   /* quantifier_offset */
+    offsetof(MoveAnalysis, best_move),
+    NULL,
+    &protobuf_c_empty_string,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "eval_before",
+    4,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_INT32,
+    0,   /* quantifier_offset */
+    offsetof(MoveAnalysis, eval_before),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "eval_after",
+    5,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_INT32,
+    0,   /* quantifier_offset */
+    offsetof(MoveAnalysis, eval_after),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "blunder",
+    6,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_BOOL,
+    0,   /* quantifier_offset */
+    offsetof(MoveAnalysis, blunder),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned move_analysis__field_indices_by_name[] = {
+  2,   /* field[2] = best_move */
+  5,   /* field[5] = blunder */
+  4,   /* field[4] = eval_after */
+  3,   /* field[3] = eval_before */
+  1,   /* field[1] = move */
+  0,   /* field[0] = ply */
+};
+static const ProtobufCIntRange move_analysis__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 6 }
+};
+const ProtobufCMessageDescriptor move_analysis__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "MoveAnalysis",
+  "MoveAnalysis",
+  "MoveAnalysis",
+  "",
+  sizeof(MoveAnalysis),
+  6,
+  move_analysis__field_descriptors,
+  move_analysis__field_indices_by_name,
+  1,  move_analysis__number_ranges,
+  (ProtobufCMessageInit) move_analysis__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor analyze_game_response__field_descriptors[5] =
+{
+  {
+    "game_id",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    0,   /* quantifier_offset */
+    offsetof(AnalyzeGameResponse, game_id),
+    NULL,
+    &protobuf_c_empty_string,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "success",
+    2,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_BOOL,
+    0,   /* quantifier_offset */
+    offsetof(AnalyzeGameResponse, success),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "message",
+    3,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_STRING,
+    0,   /* quantifier_offset */
+    offsetof(AnalyzeGameResponse, message),
+    NULL,
+    &protobuf_c_empty_string,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "moves",
+    4,
+    PROTOBUF_C_LABEL_REPEATED,
+    PROTOBUF_C_TYPE_MESSAGE,
+    offsetof(AnalyzeGameResponse, n_moves),
+    offsetof(AnalyzeGameResponse, moves),
+    &move_analysis__descriptor,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "depth",
+    5,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_INT32,
+    0,   /* quantifier_offset */
+    offsetof(AnalyzeGameResponse, depth),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned analyze_game_response__field_indices_by_name[] = {
+  4,   /* field[4] = depth */
+  0,   /* field[0] = game_id */
+  2,   /* field[2] = message */
+  3,   /* field[3] = moves */
+  1,   /* field[1] = success */
+};
+static const ProtobufCIntRange analyze_game_response__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 5 }
+};
+const ProtobufCMessageDescriptor analyze_game_response__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "AnalyzeGameResponse",
+  "AnalyzeGameResponse",
+  "AnalyzeGameResponse",
+  "",
+  sizeof(AnalyzeGameResponse),
+  5,
+  analyze_game_response__field_descriptors,
+  analyze_game_response__field_indices_by_name,
+  1,  analyze_game_response__number_ranges,
+  (ProtobufCMessageInit) analyze_game_response__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
 static const ProtobufCFieldDescriptor error_response__field_descriptors[4] =
 {
   {
@@ -24,6 +24,7 @@ typedef struct _CancelMatchRequest CancelMatchRequest;
 typedef struct _MoveRequest MoveRequest;
 typedef struct _ResignRequest ResignRequest;
 typedef struct _ChatRequest ChatRequest;
+typedef struct _AnalyzeGameRequest AnalyzeGameRequest;
 typedef struct _ServerMessage ServerMessage;
 typedef struct _PingResponse PingResponse;
 typedef struct _EchoResponse EchoResponse;
@@ -36,6 +37,8 @@ typedef struct _CheckBroadcast CheckBroadcast;
 typedef struct _ResignBroadcast ResignBroadcast;
 typedef struct _GameEndBroadcast GameEndBroadcast;
 typedef struct _ChatBroadcast ChatBroadcast;
+typedef struct _MoveAnalysis MoveAnalysis;
+typedef struct _AnalyzeGameResponse AnalyzeGameResponse;
 typedef struct _ErrorResponse ErrorResponse;
 
 
@@ -116,7 +119,8 @@ typedef enum {
   CLIENT_MESSAGE__MSG_CANCEL_MATCH = 21,
   CLIENT_MESSAGE__MSG_MOVE = 22,
   CLIENT_MESSAGE__MSG_RESIGN = 23,
-  CLIENT_MESSAGE__MSG_CHAT = 24
+  CLIENT_MESSAGE__MSG_CHAT = 24,
+  CLIENT_MESSAGE__MSG_ANALYZE_GAME = 25
     PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(CLIENT_MESSAGE__MSG)
 } ClientMessage__MsgCase;
 
@@ -139,6 +143,7 @@ struct  _ClientMessage
     MoveRequest *move;
     ResignRequest *resign;
     ChatRequest *chat;
+    AnalyzeGameRequest *analyze_game;
   };
 };
 #define CLIENT_MESSAGE__INIT \
@@ -221,10 +226,14 @@ struct  _MoveRequest
    * 요청 시점 타임스탬프
    */
   Google__Protobuf__Timestamp *timestamp;
+  /*
+   * 프로모션 기물 (PT_KNIGHT/BISHOP/ROOK/QUEEN, 프로모션이 아니거나 PT_NONE이면 퀸)
+   */
+  PieceType promotion;
 };
 #define MOVE_REQUEST__INIT \
  { PROTOBUF_C_MESSAGE_INIT (&move_request__descriptor) \
-    , (char *)protobuf_c_empty_string, (char *)protobuf_c_empty_string, NULL }
+    , (char *)protobuf_c_empty_string, (char *)protobuf_c_empty_string, NULL, PIECE_TYPE__PT_NONE }
 
 
 /*
@@ -254,6 +263,27 @@ struct  _ChatRequest
     , (char *)protobuf_c_empty_string, NULL }
 
 
+/*
+ * 끝난 게임 분석 요청 (서버는 끝난 게임을 보관하지 않으므로 수 목록을 함께 보낸다)
+ */
+struct  _AnalyzeGameRequest
+{
+  ProtobufCMessage base;
+  /*
+   * 클라이언트가 알고 있는 게임 ID (응답에 그대로 돌려준다)
+   */
+  char *game_id;
+  /*
+   * 시작 위치부터 둔 수 (좌표 표기, 예: "e2e4", "e7e8q")
+   */
+  size_t n_moves;
+  char **moves;
+};
+#define ANALYZE_GAME_REQUEST__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&analyze_game_request__descriptor) \
+    , (char *)protobuf_c_empty_string, 0,NULL }
+
+
 typedef enum {
   SERVER_MESSAGE__MSG__NOT_SET = 0,
   SERVER_MESSAGE__MSG_PING_RES = 10,
@@ -267,6 +297,7 @@ typedef enum {
   SERVER_MESSAGE__MSG_CHAT_BROADCAST = 26,
   SERVER_MESSAGE__MSG_RESIGN_RES = 27,
   SERVER_MESSAGE__MSG_RESIGN_BROADCAST = 28,
+  SERVER_MESSAGE__MSG_ANALYZE_GAME_RES = 29,
   SERVER_MESSAGE__MSG_ERROR = 99
     PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(SERVER_MESSAGE__MSG)
 } ServerMessage__MsgCase;
@@ -294,6 +325,7 @@ struct  _ServerMessage
     ChatBroadcast *chat_broadcast;
     ResignResponse *resign_res;
     ResignBroadcast *resign_broadcast;
+    AnalyzeGameResponse *analyze_game_res;
     /*
      * 그 외 새 기능 추가 시 확장 가능
      */
@@ -592,6 +624,66 @@ struct  _ChatBroadcast
     , (char *)protobuf_c_empty_string, (char *)protobuf_c_empty_string, NULL }
 
 
+/*
+ * 한 수에 대한 분석 결과 (평가값은 백 기준 센티폰)
+ */
+struct  _MoveAnalysis
+{
+  ProtobufCMessage base;
+  /*
+   * 0부터 세는 반수 번호
+   */
+  int32_t ply;
+  /*
+   * 실제로 둔 수
+   */
+  char *move;
+  /*
+   * 엔진이 고른 최선 수
+   */
+  char *best_move;
+  /*
+   * 수를 두기 전 국면 평가
+   */
+  int32_t eval_before;
+  /*
+   * 수를 둔 뒤 국면 평가
+   */
+  int32_t eval_after;
+  /*
+   * 둔 쪽이 기준 이상 손해를 봤는지
+   */
+  protobuf_c_boolean blunder;
+};
+#define MOVE_ANALYSIS__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&move_analysis__descriptor) \
+    , 0, (char *)protobuf_c_empty_string, (char *)protobuf_c_empty_string, 0, 0, 0 }
+
+
+/*
+ * 게임 분석 결과
+ */
+struct  _AnalyzeGameResponse
+{
+  ProtobufCMessage base;
+  char *game_id;
+  protobuf_c_boolean success;
+  /*
+   * 실패 시 이유
+   */
+  char *message;
+  size_t n_moves;
+  MoveAnalysis **moves;
+  /*
+   * 국면당 탐색 깊이 (시간 상한에 걸린 국면이 있으면 가장 얕은 값)
+   */
+  int32_t depth;
+};
+#define ANALYZE_GAME_RESPONSE__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&analyze_game_response__descriptor) \
+    , (char *)protobuf_c_empty_string, 0, (char *)protobuf_c_empty_string, 0,NULL, 0 }
+
+
 /*
  * 오류를 통일해서 보낼 때
  */
@@ -772,6 +864,25 @@ ChatRequest *
 void   chat_request__free_unpacked
                      (ChatRequest *message,
                       ProtobufCAllocator *allocator);
+/* AnalyzeGameRequest methods */
+void   analyze_game_request__init
+                     (AnalyzeGameRequest         *message);
+size_t analyze_game_request__get_packed_size
+                     (const AnalyzeGameRequest   *message);
+size_t analyze_game_request__pack
+                     (const AnalyzeGameRequest   *message,
+                      uint8_t             *out);
+size_t analyze_game_request__pack_to_buffer
+                     (const AnalyzeGameRequest   *message,
+                      ProtobufCBuffer     *buffer);
+AnalyzeGameRequest *
+       analyze_game_request__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   analyze_game_request__free_unpacked
+                     (AnalyzeGameRequest *message,
+                      ProtobufCAllocator *allocator);
 /* ServerMessage methods */
 void   server_message__init
                      (ServerMessage         *message);
@@ -1000,6 +1111,44 @@ ChatBroadcast *
 void   chat_broadcast__free_unpacked
                      (ChatBroadcast *message,
                       ProtobufCAllocator *allocator);
+/* MoveAnalysis methods */
+void   move_analysis__init
+                     (MoveAnalysis         *message);
+size_t move_analysis__get_packed_size
+                     (const MoveAnalysis   *message);
+size_t move_analysis__pack
+                     (const MoveAnalysis   *message,
+                      uint8_t             *out);
+size_t move_analysis__pack_to_buffer
+                     (const MoveAnalysis   *message,
+                      ProtobufCBuffer     *buffer);
+MoveAnalysis *
+       move_analysis__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   move_analysis__free_unpacked
+                     (MoveAnalysis *message,
+                      ProtobufCAllocator *allocator);
+/* AnalyzeGameResponse methods */
+void   analyze_game_response__init
+                     (AnalyzeGameResponse         *message);
+size_t analyze_game_response__get_packed_size
+                     (const AnalyzeGameResponse   *message);
+size_t analyze_game_response__pack
+                     (const AnalyzeGameResponse   *message,
+                      uint8_t             *out);
+size_t analyze_game_response__pack_to_buffer
+                     (const AnalyzeGameResponse   *message,
+                      ProtobufCBuffer     *buffer);
+AnalyzeGameResponse *
+       analyze_game_response__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   analyze_game_response__free_unpacked
+                     (AnalyzeGameResponse *message,
+                      ProtobufCAllocator *allocator);
 /* ErrorResponse methods */
 void   error_response__init
                      (ErrorResponse         *message);
@@ -1045,6 +1194,9 @@ typedef void (*ResignRequest_Closure)
 typedef void (*ChatRequest_Closure)
                  (const ChatRequest *message,
                   void *closure_data);
+typedef void (*AnalyzeGameRequest_Closure)
+                 (const AnalyzeGameRequest *message,
+                  void *closure_data);
 typedef void (*ServerMessage_Closure)
                  (const ServerMessage *message,
                   void *closure_data);
@@ -1081,6 +1233,12 @@ typedef void (*GameEndBroadcast_Closure)
 typedef void (*ChatBroadcast_Closure)
                  (const ChatBroadcast *message,
                   void *closure_data);
+typedef void (*MoveAnalysis_Closure)
+                 (const MoveAnalysis *message,
+                  void *closure_data);
+typedef void (*AnalyzeGameResponse_Closure)
+                 (const AnalyzeGameResponse *message,
+                  void *closure_data);
 typedef void (*ErrorResponse_Closure)
                  (const ErrorResponse *message,
                   void *closure_data);
@@ -1102,6 +1260,7 @@ extern const ProtobufCMessageDescriptor cancel_match_request__descriptor;
 extern const ProtobufCMessageDescriptor move_request__descriptor;
 extern const ProtobufCMessageDescriptor resign_request__descriptor;
 extern const ProtobufCMessageDescriptor chat_request__descriptor;
+extern const ProtobufCMessageDescriptor analyze_game_request__descriptor;
 extern const ProtobufCMessageDescriptor server_message__descriptor;
 extern const ProtobufCMessageDescriptor ping_response__descriptor;
 extern const ProtobufCMessageDescriptor echo_response__descriptor;
@@ -1114,6 +1273,8 @@ extern const ProtobufCMessageDescriptor check_broadcast__descriptor;
 extern const ProtobufCMessageDescriptor resign_broadcast__descriptor;
 extern const ProtobufCMessageDescriptor game_end_broadcast__descriptor;
 extern const ProtobufCMessageDescriptor chat_broadcast__descriptor;
+extern const ProtobufCMessageDescriptor move_analysis__descriptor;
+extern const ProtobufCMessageDescriptor analyze_game_response__descriptor;
 extern const ProtobufCMessageDescriptor error_response__descriptor;
 
 PROTOBUF_C__END_DECLS
@@ -0,0 +1,37 @@
+// legal_cache.c
+#include "legal_cache.h"
+
+void legal_cache_reset(legal_cache_t *c) {
+    c->hash     = 0;
+    c->valid    = false;
+    c->in_check = false;
+    c->count    = 0;
+}
+
+void legal_cache_fill(legal_cache_t *c, const game_t *G) {
+    c->hash     = G->hash;
+    c->in_check = is_in_check(G, G->side_to_move);
+    c->count    = generate_legal_moves(G, c->moves);
+    c->valid    = true;
+}
+
+const legal_cache_t *legal_cache_get(legal_cache_t *c, const game_t *G) {
+    if (!c->valid || c->hash != G->hash)
+        legal_cache_fill(c, G);
+    return c;
+}
+
+move_t legal_cache_find(const legal_cache_t *c, move_t m) {
+    // 플래그 없이 들어온 프로모션은 퀸으로 취급
+    piece_type_t promotion = (move_flag(m) == MOVE_FLAG_PROMOTION) ? move_promotion(m) : PIECE_QUEEN;
+
+    for (int i = 0; i < c->count; i++) {
+        move_t cand = c->moves[i];
+        if (!move_same_squares(cand, m))
+            continue;
+        if (move_flag(cand) == MOVE_FLAG_PROMOTION && move_promotion(cand) != promotion)
+            continue;
+        return cand;
+    }
+    return MOVE_NONE;
+}
@@ -0,0 +1,43 @@
+// legal_cache.h
+#ifndef COMMON_LEGAL_CACHE_H
+#define COMMON_LEGAL_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "move.h"
+#include "rule.h"
+
+// 국면 해시로 식별되는 합법 수 캐시 (게임마다 하나)
+// apply_move 직후 한 번 채워 두면 다음 수 검증은 목록 조회가 되고,
+// 체크/체크메이트/스테일메이트 판정은 다시 계산할 필요가 없다
+typedef struct {
+    uint64_t hash;      // 캐시된 국면의 해시 (game_t.hash)
+    bool     valid;     // 채워진 적이 있는지
+    bool     in_check;  // side_to_move가 체크 상태인지
+    int      count;     // 합법 수 개수
+    move_t   moves[MAX_LEGAL_MOVES];
+} legal_cache_t;
+
+// 캐시 비우기
+void legal_cache_reset(legal_cache_t *c);
+
+// G의 합법 수와 체크 상태로 캐시를 다시 채운다
+void legal_cache_fill(legal_cache_t *c, const game_t *G);
+
+// 캐시가 G와 다른 국면이면 다시 채운 뒤 반환
+const legal_cache_t *legal_cache_get(legal_cache_t *c, const game_t *G);
+
+// m과 같은 수(출발/도착 칸, 프로모션 기물)를 찾아 생성기가 붙인 플래그까지 포함한 수를 반환
+// 합법 수가 아니면 MOVE_NONE
+move_t legal_cache_find(const legal_cache_t *c, move_t m);
+
+static inline bool legal_cache_is_checkmate(const legal_cache_t *c) {
+    return c->in_check && c->count == 0;
+}
+
+static inline bool legal_cache_is_stalemate(const legal_cache_t *c) {
+    return !c->in_check && c->count == 0;
+}
+
+#endif  // COMMON_LEGAL_CACHE_H
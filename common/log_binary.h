@@ -0,0 +1,67 @@
+#ifndef COMMON_LOG_BINARY_H
+#define COMMON_LOG_BINARY_H
+
+#include <stdint.h>
+
+// 바이너리 로그 파일 형식 (logger가 쓰고 logdecode가 읽는다)
+// 값은 쓴 호스트의 바이트 순서 그대로이며, 레코드는 정렬 없이 이어 붙는다
+//
+//   파일   = 헤더 레코드*
+//   레코드 = log_rec_header_t 본문[length]
+//
+// 호출 위치(형식 문자열, 파일, 줄, 함수)는 처음 쓰일 때 SITE 레코드로 한 번만 기록하고,
+// 이후 EVENT 레코드는 위치 id와 시각, 인코딩된 인자만 담는다.
+
+#define LOG_BINARY_MAGIC   0x474f4c42u  // "BLOG"
+#define LOG_BINARY_VERSION 1
+
+// 파일 헤더: EVENT의 단조 시계 값을 벽시계로 바꾸기 위한 기준점
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    int64_t  realtime_ns;   // 로거 시작 시각 (CLOCK_REALTIME)
+    int64_t  monotonic_ns;  // 같은 순간의 CLOCK_MONOTONIC
+} log_binary_header_t;
+
+typedef enum {
+    LOG_REC_SITE    = 1,  // 본문: log_site_t + format + file + func (NUL 없음)
+    LOG_REC_EVENT   = 2,  // 본문: log_event_t + 인코딩된 인자
+    LOG_REC_DROPPED = 3   // 본문: uint32_t 버린 레코드 수
+} log_rec_type_t;
+
+// 레코드 머리
+typedef struct {
+    uint8_t  type;
+    uint8_t  level;  // EVENT만 사용
+    uint16_t reserved;
+    uint32_t length;  // 뒤따르는 본문 바이트 수
+} log_rec_header_t;
+
+// 호출 위치 정의
+typedef struct {
+    uint32_t id;
+    int32_t  line;
+    uint16_t format_len;
+    uint16_t file_len;
+    uint16_t func_len;
+    uint16_t reserved;
+} log_site_t;
+
+// 로그 한 건
+typedef struct {
+    uint32_t site_id;
+    uint32_t reserved;
+    int64_t  ts_ns;  // CLOCK_MONOTONIC
+} log_event_t;
+
+// 인자 인코딩: 타입 1바이트 뒤에 값
+// 형식 문자열의 '*' 너비/정밀도도 순서대로 LOG_ARG_INT로 들어간다
+typedef enum {
+    LOG_ARG_INT     = 1,  // int64_t (%d %i %c)
+    LOG_ARG_UINT    = 2,  // uint64_t (%u %x %X %o)
+    LOG_ARG_DOUBLE  = 3,  // double (%f %e %g %a, long double은 double로 줄인다)
+    LOG_ARG_STRING  = 4,  // uint16_t 길이 + 바이트 (%s, 정밀도만큼만)
+    LOG_ARG_POINTER = 5   // uint64_t (%p)
+} log_arg_type_t;
+
+#endif  // COMMON_LOG_BINARY_H
@@ -1,10 +1,19 @@
 #include "logger.h"
 
+#include <fcntl.h>
 #include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <strings.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include "clock.h"
+#include "log_binary.h"
+
 // ANSI 색상 코드 정의
 #define RESET  "\033[0m"
 #define CYAN   "\033[96m"  // 타임스탬프
@@ -15,153 +24,766 @@
 #define BLUE   "\033[94m"  // DEBUG
 #define GRAY   "\033[90m"  // 함수명
 
-static FILE             *log_file            = NULL;
-static log_output_type_t output_type         = LOG_OUTPUT_CONSOLE;
-static pthread_mutex_t   log_mutex           = PTHREAD_MUTEX_INITIALIZER;
-static const char       *log_level_strings[] = {
+#define LOG_MAX_THREADS       64               // 동시에 로그를 남길 수 있는 스레드 수
+#define LOG_RING_SIZE         (64 * 1024)      // 스레드별 링 버퍼 크기 (2의 거듭제곱)
+#define LOG_MESSAGE_MAX       1024             // 포맷된 메시지 최대 길이 (NUL 포함)
+#define LOG_LINE_MAX          (LOG_MESSAGE_MAX * 3)  // 레코드 하나가 출력에서 차지하는 최대 크기 (텍스트 한 줄 또는 SITE+EVENT)
+#define LOG_SITE_TABLE_SIZE   4096             // 바이너리 모드에서 기억하는 호출 위치 수 (2의 거듭제곱)
+#define LOG_SITE_STRING_MAX   1024             // SITE 레코드의 문자열 하나 최대 길이
+#define LOG_BATCH_SIZE        (64 * 1024)      // 라이터 스레드가 write 한 번에 모으는 크기
+#define LOG_IDLE_SLEEP_MIN_US 1000             // 링이 비었을 때 라이터의 첫 대기 시간
+#define LOG_IDLE_SLEEP_MAX_US 50000            // 계속 비어 있으면 두 배씩 늘려 이 값까지
+
+// 링 버퍼에 들어가는 레코드 헤더 (뒤에 메시지 바이트가 붙는다)
+// file/func/format은 __FILE__/__func__/형식 리터럴이므로 포인터만 넘긴다
+// 바이너리 모드에서는 메시지 대신 인코딩된 인자가 붙고, 인코딩하지 못한 호출은 format이 NULL이고 포맷된 메시지가 붙는다
+typedef struct {
+    struct timespec ts;  // 텍스트 모드는 캐시된 벽시계, 바이너리 모드는 CLOCK_MONOTONIC
+    const char     *file;
+    const char     *func;
+    const char     *format;
+    int32_t         line;
+    uint16_t        level;
+    uint16_t        length;  // 메시지(NUL 제외) 또는 인코딩된 인자 길이
+} log_record_t;
+
+#define LOG_RECORD_ALIGN 8
+#define LOG_RECORD_MAX   (sizeof(log_record_t) + LOG_MESSAGE_MAX)
+
+_Static_assert((LOG_RING_SIZE & (LOG_RING_SIZE - 1)) == 0, "ring size must be a power of two");
+_Static_assert(sizeof(log_record_t) % LOG_RECORD_ALIGN == 0, "record header must keep alignment");
+
+// 링 상태 (CLAIMING 동안 소유 스레드가 버퍼를 준비하고, CLOSED는 스레드 종료 후 남은 레코드를 비우는 중)
+enum {
+    RING_FREE = 0,
+    RING_CLAIMING,
+    RING_ACTIVE,
+    RING_CLOSED
+};
+
+// 스레드별 단일 생산자/단일 소비자 링
+// head는 소유 스레드만, tail은 라이터 스레드만 증가시킨다 (둘 다 단조 증가하는 바이트 위치)
+typedef struct {
+    _Alignas(64) atomic_size_t head;
+    _Alignas(64) atomic_size_t tail;
+    _Alignas(64) atomic_int state;
+    atomic_uint           dropped;  // 링이 가득 차서 버린 레코드 수
+    volatile sig_atomic_t busy;     // 같은 스레드의 재진입(시그널 핸들러) 감지
+    unsigned char        *buf;
+} log_ring_t;
+
+// 바이너리 모드의 호출 위치 (라이터 스레드 전용)
+typedef struct {
+    const char *format;
+    const char *file;
+    int32_t     line;
+    uint32_t    id;  // 0이면 빈 칸
+} log_site_slot_t;
+
+static struct {
+    log_ring_t        rings[LOG_MAX_THREADS];
+    atomic_bool       running;     // 라이터 스레드가 링을 비우고 있음
+    atomic_uint       no_ring;     // 링을 얻지 못해 버린 레코드 수
+    log_output_type_t output_type;
+    int               fd;          // 출력 대상 (콘솔이면 stdout, 파일 모드에서 닫혔으면 -1)
+    pthread_t         writer;
+    pthread_key_t     ring_key;
+    pthread_once_t    key_once;
+    bool              atexit_registered;
+} g_logger = {
+    .output_type = LOG_OUTPUT_CONSOLE,
+    .fd          = STDOUT_FILENO,
+    .key_once    = PTHREAD_ONCE_INIT,
+};
+
+static __thread log_ring_t *t_ring;
+
+atomic_int g_log_level = LOG_DEBUG;
+
+static const char *log_level_strings[] = {
     "DEBUG", "INFO", "WARN", "ERROR", "FATAL"};
 
+// 스레드가 끝나면 링을 닫아 두고, 라이터가 남은 레코드를 비운 뒤 반환한다
+static void release_thread_ring(void *arg) {
+    log_ring_t *ring = arg;
+    atomic_store_explicit(&ring->state, RING_CLOSED, memory_order_release);
+}
+
+static void create_ring_key(void) {
+    pthread_key_create(&g_logger.ring_key, release_thread_ring);
+}
+
+// 호출 스레드의 링 (처음 로그를 남길 때 빈 링을 하나 차지한다)
+static log_ring_t *thread_ring(void) {
+    if (t_ring)
+        return t_ring;
+
+    pthread_once(&g_logger.key_once, create_ring_key);
+    for (int i = 0; i < LOG_MAX_THREADS; i++) {
+        log_ring_t *ring     = &g_logger.rings[i];
+        int         expected = RING_FREE;
+        if (!atomic_compare_exchange_strong(&ring->state, &expected, RING_CLAIMING))
+            continue;
+
+        // 버퍼는 반환 후에도 남겨 두고 다음 스레드가 재사용한다
+        if (!ring->buf && !(ring->buf = malloc(LOG_RING_SIZE))) {
+            atomic_store_explicit(&ring->state, RING_FREE, memory_order_release);
+            return NULL;
+        }
+        atomic_store_explicit(&ring->head, 0, memory_order_relaxed);
+        atomic_store_explicit(&ring->tail, 0, memory_order_relaxed);
+        atomic_store_explicit(&ring->dropped, 0, memory_order_relaxed);
+        ring->busy = 0;
+        atomic_store_explicit(&ring->state, RING_ACTIVE, memory_order_release);
+
+        pthread_setspecific(g_logger.ring_key, ring);
+        t_ring = ring;
+        return ring;
+    }
+    return NULL;
+}
+
+// 링 끝에 최대 크기 레코드가 들어갈 자리가 없으면 처음으로 건너뛴다 (생산자/소비자 공통 규칙)
+static inline size_t ring_skip(size_t pos) {
+    size_t room = LOG_RING_SIZE - (pos & (LOG_RING_SIZE - 1));
+    return room < LOG_RECORD_MAX ? room : 0;
+}
+
+static inline size_t record_size(const log_record_t *rec) {
+    return (sizeof(log_record_t) + rec->length + LOG_RECORD_ALIGN - 1) & ~(size_t)(LOG_RECORD_ALIGN - 1);
+}
+
+// 레코드 하나를 출력 형식의 한 줄로 만든다 (콘솔은 색상 적용)
+static size_t format_line(char *out, size_t size, const log_record_t *rec, const char *message) {
+    char timestamp[CLOCK_TIMESTAMP_LEN];
+    clock_format_timestamp(rec->ts.tv_sec, timestamp);
+
+    // 파일명에서 경로 제거
+    const char *filename = strrchr(rec->file, '/');
+    filename             = filename ? filename + 1 : rec->file;
+
+    int n;
+    if (g_logger.output_type == LOG_OUTPUT_FILE) {
+        n = snprintf(out, size, "[%s] [%s] %s:%d %s() - %.*s\n",
+                     timestamp, log_level_strings[rec->level], filename, rec->line, rec->func,
+                     (int)rec->length, message);
+    } else {
+        const char *level_color;
+        switch (rec->level) {
+            case LOG_DEBUG:
+                level_color = BLUE;
+                break;
+            case LOG_INFO:
+                level_color = GREEN;
+                break;
+            case LOG_WARN:
+                level_color = YELLOW;
+                break;
+            case LOG_ERROR:
+            case LOG_FATAL:
+                level_color = RED;
+                break;
+            default:
+                level_color = RESET;
+        }
+
+        n = snprintf(out, size, "%s[%s]%s %s[%s]%s %s%s:%d%s %s%s()%s - %.*s\n",
+                     CYAN, timestamp, RESET,                              // 타임스탬프
+                     level_color, log_level_strings[rec->level], RESET,  // 로그 레벨
+                     PURPLE, filename, rec->line, RESET,                  // 파일명:라인번호
+                     GRAY, rec->func, RESET,                              // 함수명
+                     (int)rec->length, message                            // 메시지
+        );
+    }
+
+    if (n < 0)
+        return 0;
+    if ((size_t)n >= size) {
+        // 잘린 줄도 줄바꿈으로 끝낸다
+        out[size - 2] = '\n';
+        return size - 1;
+    }
+    return (size_t)n;
+}
+
+// 바이너리 레코드 하나를 out에 쓰고 다음 위치를 반환
+static char *put_binary_record(char *out, uint8_t type, uint8_t level, const void *body, size_t body_len,
+                               const void *tail, size_t tail_len) {
+    log_rec_header_t hdr = {.type = type, .level = level, .length = (uint32_t)(body_len + tail_len)};
+    memcpy(out, &hdr, sizeof(hdr));
+    memcpy(out + sizeof(hdr), body, body_len);
+    if (tail_len > 0)
+        memcpy(out + sizeof(hdr) + body_len, tail, tail_len);
+    return out + sizeof(hdr) + body_len + tail_len;
+}
+
+// 호출 위치 id (처음 보는 위치면 SITE 레코드를 먼저 쓴다)
+static uint32_t binary_site_id(char **out, const log_record_t *rec) {
+    static log_site_slot_t sites[LOG_SITE_TABLE_SIZE];
+    static uint32_t        next_id = 1;
+
+    uint64_t key  = (uint64_t)(uintptr_t)rec->format ^ ((uint64_t)(uintptr_t)rec->file * 31) ^ (uint64_t)rec->line;
+    size_t   slot = (size_t)((key * 0x9E3779B97F4A7C15ULL) >> 52) & (LOG_SITE_TABLE_SIZE - 1);
+    for (size_t probe = 0; probe < LOG_SITE_TABLE_SIZE; probe++) {
+        log_site_slot_t *s = &sites[(slot + probe) & (LOG_SITE_TABLE_SIZE - 1)];
+        if (s->id == 0) {
+            s->format = rec->format;
+            s->file   = rec->file;
+            s->line   = rec->line;
+            s->id     = next_id;
+            break;
+        }
+        if (s->format == rec->format && s->file == rec->file && s->line == rec->line)
+            return s->id;
+    }
+    // 표가 가득 찼으면 기억하지 못한 채 매번 새 id로 정의한다
+
+    // 인코딩하지 못한 호출은 포맷된 메시지 하나를 %s 인자로 싣는다
+    const char *format   = rec->format ? rec->format : "%s";
+    const char *filename = strrchr(rec->file, '/');
+    filename             = filename ? filename + 1 : rec->file;
+
+    log_site_t site = {
+        .id         = next_id,
+        .line       = rec->line,
+        .format_len = (uint16_t)strnlen(format, LOG_SITE_STRING_MAX),
+        .file_len   = (uint16_t)strnlen(filename, LOG_SITE_STRING_MAX / 4),
+        .func_len   = (uint16_t)strnlen(rec->func, LOG_SITE_STRING_MAX / 4),
+    };
+    char strings[LOG_SITE_STRING_MAX * 3 / 2];
+    memcpy(strings, format, site.format_len);
+    memcpy(strings + site.format_len, filename, site.file_len);
+    memcpy(strings + site.format_len + site.file_len, rec->func, site.func_len);
+    *out = put_binary_record(*out, LOG_REC_SITE, 0, &site, sizeof(site),
+                             strings, (size_t)site.format_len + site.file_len + site.func_len);
+    return next_id++;
+}
+
+// 링 레코드를 SITE(처음일 때)와 EVENT 레코드로 옮긴다
+static size_t format_binary(char *out, const log_record_t *rec) {
+    char       *p     = out;
+    log_event_t event = {
+        .site_id = binary_site_id(&p, rec),
+        .ts_ns   = (int64_t)rec->ts.tv_sec * 1000000000LL + rec->ts.tv_nsec,
+    };
+
+    if (rec->format) {
+        p = put_binary_record(p, LOG_REC_EVENT, (uint8_t)rec->level, &event, sizeof(event), rec + 1, rec->length);
+    } else {
+        unsigned char arg[1 + sizeof(uint16_t)] = {LOG_ARG_STRING};
+        uint16_t      len                       = rec->length;
+        memcpy(arg + 1, &len, sizeof(len));
+
+        char body[sizeof(event) + sizeof(arg)];
+        memcpy(body, &event, sizeof(event));
+        memcpy(body + sizeof(event), arg, sizeof(arg));
+        p = put_binary_record(p, LOG_REC_EVENT, (uint8_t)rec->level, body, sizeof(body), rec + 1, rec->length);
+    }
+    return (size_t)(p - out);
+}
+
+// 버린 레코드 수 알림 (텍스트는 한 줄, 바이너리는 DROPPED 레코드)
+static size_t format_dropped(char *out, unsigned count, const char *reason) {
+    if (g_logger.output_type == LOG_OUTPUT_BINARY) {
+        uint32_t n = count;
+        return (size_t)(put_binary_record(out, LOG_REC_DROPPED, 0, &n, sizeof(n), NULL, 0) - out);
+    }
+    int n = snprintf(out, LOG_LINE_MAX, "[logger] %u log message(s) dropped (%s)\n", count, reason);
+    return n < 0 ? 0 : (size_t)n;
+}
+
+// fd에 전부 쓴다 (EINTR/부분 쓰기 재시도)
+static void write_all(int fd, const char *buf, size_t len) {
+    while (len > 0 && fd >= 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+}
+
+// 라이터 스레드: 모든 링을 한 바퀴 비우며 출력할 줄을 모아 write 한다
+// 반환값은 꺼낸 레코드 수
+static size_t drain_rings(void) {
+    static char batch[LOG_BATCH_SIZE];
+    size_t      len   = 0;
+    size_t      count = 0;
+
+    for (int i = 0; i < LOG_MAX_THREADS; i++) {
+        log_ring_t *ring  = &g_logger.rings[i];
+        int         state = atomic_load_explicit(&ring->state, memory_order_acquire);
+        if (state != RING_ACTIVE && state != RING_CLOSED)
+            continue;
+
+        size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        while (tail != head) {
+            tail += ring_skip(tail);
+            const log_record_t *rec = (const log_record_t *)(ring->buf + (tail & (LOG_RING_SIZE - 1)));
+
+            if (LOG_BATCH_SIZE - len < LOG_LINE_MAX) {
+                write_all(g_logger.fd, batch, len);
+                len = 0;
+            }
+            if (g_logger.output_type == LOG_OUTPUT_BINARY)
+                len += format_binary(batch + len, rec);
+            else
+                len += format_line(batch + len, LOG_LINE_MAX, rec, (const char *)(rec + 1));
+            tail += record_size(rec);
+            count++;
+        }
+        // 줄로 옮겨 적었으므로 생산자에게 자리를 돌려준다
+        atomic_store_explicit(&ring->tail, tail, memory_order_release);
+
+        unsigned dropped = atomic_exchange_explicit(&ring->dropped, 0, memory_order_relaxed);
+        if (dropped > 0) {
+            if (LOG_BATCH_SIZE - len < LOG_LINE_MAX) {
+                write_all(g_logger.fd, batch, len);
+                len = 0;
+            }
+            len += format_dropped(batch + len, dropped, "ring full");
+        }
+
+        // 끝난 스레드의 링은 다 비웠으면 반환
+        if (state == RING_CLOSED && atomic_load_explicit(&ring->head, memory_order_acquire) == tail)
+            atomic_store_explicit(&ring->state, RING_FREE, memory_order_release);
+    }
+
+    unsigned no_ring = atomic_exchange_explicit(&g_logger.no_ring, 0, memory_order_relaxed);
+    if (no_ring > 0) {
+        if (LOG_BATCH_SIZE - len < LOG_LINE_MAX) {
+            write_all(g_logger.fd, batch, len);
+            len = 0;
+        }
+        len += format_dropped(batch + len, no_ring, "too many threads");
+    }
+
+    write_all(g_logger.fd, batch, len);
+    return count;
+}
+
+// 라이터 스레드: 링이 비어 있으면 대기 시간을 늘려 가며 잠든다
+static void *writer_thread(void *arg) {
+    (void)arg;
+    useconds_t idle_us = LOG_IDLE_SLEEP_MIN_US;
+
+    while (1) {
+        bool stopping = !atomic_load_explicit(&g_logger.running, memory_order_acquire);
+        if (drain_rings() > 0) {
+            idle_us = LOG_IDLE_SLEEP_MIN_US;
+        } else if (!stopping) {
+            usleep(idle_us);
+            if (idle_us < LOG_IDLE_SLEEP_MAX_US)
+                idle_us *= 2;
+        }
+        // 종료 요청 이후 한 번 더 비웠으면 끝낸다
+        if (stopping)
+            break;
+    }
+    return NULL;
+}
+
+// 라이터 스레드가 없을 때 (초기화 전, 정리 후) 호출 스레드에서 바로 출력
+static void write_sync(const log_record_t *rec, const char *message) {
+    char line[LOG_LINE_MAX];
+    write_all(g_logger.fd, line, format_line(line, sizeof(line), rec, message));
+}
+
 // 로거 초기화
 int logger_init(log_output_type_t type, const char *file_path_or_prefix) {
-    pthread_mutex_lock(&log_mutex);
+    char log_filename[256];
 
-    output_type = type;
+    logger_cleanup();
 
-    if (output_type == LOG_OUTPUT_FILE) {
+    if (type == LOG_OUTPUT_FILE) {
         // 파일 출력 모드 (클라이언트용)
-        if (log_file != NULL) {
-            fclose(log_file);
-        }
-
         // logs 디렉토리 생성 (이미 존재하면 무시)
         mkdir("logs", 0755);
 
-        char log_filename[256];
         if (file_path_or_prefix) {
             snprintf(log_filename, sizeof(log_filename), "logs/%s_%d.log", file_path_or_prefix, getpid());
         } else {
             snprintf(log_filename, sizeof(log_filename), "logs/app_%d.log", getpid());
         }
 
-        log_file = fopen(log_filename, "a");
-        if (log_file == NULL) {
-            pthread_mutex_unlock(&log_mutex);
+        // 라이터 스레드가 모아서 쓰므로 stdio 버퍼 없이 fd에 직접 쓴다
+        int fd = open(log_filename, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (fd < 0)
             return -1;
-        }
 
-        // 버퍼링 비활성화 (즉시 플러시)
-        setbuf(log_file, NULL);
+        g_logger.output_type = LOG_OUTPUT_FILE;
+        g_logger.fd          = fd;
+    } else if (type == LOG_OUTPUT_BINARY) {
+        // 바이너리 파일 출력 모드 (logdecode로 텍스트/JSON 변환)
+        mkdir("logs", 0755);
+        snprintf(log_filename, sizeof(log_filename), "logs/%s_%d.blog",
+                 file_path_or_prefix ? file_path_or_prefix : "app", getpid());
 
-        pthread_mutex_unlock(&log_mutex);
-        LOG_INFO("=== Client Logger initialized (file: %s) ===", log_filename);
+        int fd = open(log_filename, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0)
+            return -1;
+
+        struct timespec     real, mono;
+        log_binary_header_t header = {.magic = LOG_BINARY_MAGIC, .version = LOG_BINARY_VERSION};
+        clock_gettime(CLOCK_REALTIME, &real);
+        clock_gettime(CLOCK_MONOTONIC, &mono);
+        header.realtime_ns  = (int64_t)real.tv_sec * 1000000000LL + real.tv_nsec;
+        header.monotonic_ns = (int64_t)mono.tv_sec * 1000000000LL + mono.tv_nsec;
+        write_all(fd, (const char *)&header, sizeof(header));
+
+        g_logger.output_type = LOG_OUTPUT_BINARY;
+        g_logger.fd          = fd;
     } else {
         // 콘솔 출력 모드 (서버용)
-        log_file = NULL;
-        pthread_mutex_unlock(&log_mutex);
-        LOG_INFO("=== Server Logger initialized (console output) ===");
+        g_logger.output_type = LOG_OUTPUT_CONSOLE;
+        g_logger.fd          = STDOUT_FILENO;
+    }
+
+    atomic_store_explicit(&g_logger.running, true, memory_order_release);
+    if (pthread_create(&g_logger.writer, NULL, writer_thread, NULL) != 0) {
+        // 라이터 없이도 동기 출력으로 동작한다
+        atomic_store_explicit(&g_logger.running, false, memory_order_release);
     }
 
+    // exit()로 끝나는 경로에서도 링에 남은 로그를 내보낸다
+    if (!g_logger.atexit_registered) {
+        atexit(logger_cleanup);
+        g_logger.atexit_registered = true;
+    }
+
+    if (g_logger.output_type == LOG_OUTPUT_FILE)
+        LOG_INFO("=== Client Logger initialized (file: %s) ===", log_filename);
+    else if (g_logger.output_type == LOG_OUTPUT_BINARY)
+        LOG_INFO("=== Logger initialized (binary file: %s) ===", log_filename);
+    else
+        LOG_INFO("=== Server Logger initialized (console output) ===");
+
     return 0;
 }
 
-// 로거 정리
+// 로거 정리 (라이터 스레드를 멈추기 전에 링에 남은 로그를 모두 출력)
 void logger_cleanup(void) {
-    pthread_mutex_lock(&log_mutex);
-
-    if (output_type == LOG_OUTPUT_FILE && log_file != NULL) {
-        // 뮤텍스를 잠근 상태에서 LOG_INFO 호출하면 데드락 발생
-        // 대신 직접 파일에 작성
-        if (log_file) {
-            fprintf(log_file, "[%s] [INFO] logger.c:%d logger_cleanup() - === Logger cleanup ===\n",
-                    "cleanup", __LINE__);
-        }
-        fclose(log_file);
-        log_file = NULL;
-    } else if (output_type == LOG_OUTPUT_CONSOLE) {
-        // 콘솔의 경우도 직접 출력
-        printf("=== Server Logger cleanup ===\n");
-        fflush(stdout);
+    if (atomic_load_explicit(&g_logger.running, memory_order_acquire)) {
+        if (g_logger.output_type != LOG_OUTPUT_CONSOLE)
+            LOG_INFO("=== Logger cleanup ===");
+        else
+            LOG_INFO("=== Server Logger cleanup ===");
     }
 
-    pthread_mutex_unlock(&log_mutex);
+    if (!atomic_exchange_explicit(&g_logger.running, false, memory_order_acq_rel))
+        return;
+
+    // 라이터 스레드 자신이 시그널을 받아 들어온 경우에는 join하지 않는다
+    if (!pthread_equal(pthread_self(), g_logger.writer))
+        pthread_join(g_logger.writer, NULL);
+
+    if (g_logger.output_type != LOG_OUTPUT_CONSOLE && g_logger.fd >= 0) {
+        close(g_logger.fd);
+        g_logger.fd = -1;
+    }
 }
 
-// 현재 시간을 문자열로 반환
-static void get_timestamp(char *buffer, size_t size) {
-    time_t     now        = time(NULL);
-    struct tm *local_time = localtime(&now);
-    strftime(buffer, size, "%Y-%m-%d %H:%M:%S", local_time);
+void logger_set_level(log_level_t level) {
+    atomic_store_explicit(&g_log_level, level, memory_order_relaxed);
 }
 
-// 콘솔 출력용 색상 적용
-static void print_colored_console_log(log_level_t level, const char *timestamp, const char *filename,
-                                      int line, const char *func, const char *message) {
-    const char *level_color;
+log_level_t logger_get_level(void) {
+    return (log_level_t)atomic_load_explicit(&g_log_level, memory_order_relaxed);
+}
 
-    switch (level) {
-        case LOG_DEBUG:
-            level_color = BLUE;
-            break;
-        case LOG_INFO:
-            level_color = GREEN;
-            break;
-        case LOG_WARN:
-            level_color = YELLOW;
-            break;
-        case LOG_ERROR:
-        case LOG_FATAL:
-            level_color = RED;
-            break;
-        default:
-            level_color = RESET;
+int logger_parse_level(const char *name) {
+    if (!name)
+        return -1;
+    for (int i = LOG_DEBUG; i <= LOG_FATAL; i++) {
+        if (strcasecmp(name, log_level_strings[i]) == 0)
+            return i;
     }
+    if (name[0] >= '0' && name[0] <= '4' && name[1] == '\0')
+        return name[0] - '0';
+    return -1;
+}
 
-    printf("%s[%s]%s %s[%s]%s %s%s:%d%s %s%s()%s - %s\n",
-           CYAN, timestamp, RESET,                        // 타임스탬프
-           level_color, log_level_strings[level], RESET,  // 로그 레벨
-           PURPLE, filename, line, RESET,                 // 파일명:라인번호
-           GRAY, func, RESET,                             // 함수명
-           message                                        // 메시지
-    );
-    fflush(stdout);
+const char *logger_level_name(log_level_t level) {
+    return (level >= LOG_DEBUG && level <= LOG_FATAL) ? log_level_strings[level] : "UNKNOWN";
 }
 
-// 로그 메시지 출력
-void log_message(log_level_t level, const char *file, int line, const char *func, const char *format, ...) {
-    pthread_mutex_lock(&log_mutex);
+// 인자 하나를 타입 바이트와 함께 쓴다 (자리가 없으면 false)
+static bool put_arg(unsigned char **out, const unsigned char *end, uint8_t type, const void *value, size_t size) {
+    if ((size_t)(end - *out) < 1 + size)
+        return false;
+    **out = type;
+    memcpy(*out + 1, value, size);
+    *out += 1 + size;
+    return true;
+}
 
-    // 타임스탬프
-    char timestamp[64];
-    get_timestamp(timestamp, sizeof(timestamp));
+static bool put_int(unsigned char **out, const unsigned char *end, int64_t v) {
+    return put_arg(out, end, LOG_ARG_INT, &v, sizeof(v));
+}
 
-    // 파일명에서 경로 제거
-    const char *filename = strrchr(file, '/');
-    if (filename == NULL) {
-        filename = file;
-    } else {
-        filename++;  // '/' 다음 문자부터
+// printf 형식 문자열을 따라가며 인자를 포맷하지 않고 원시 값으로 인코딩
+// 지원하지 않는 변환(%n, %m 등)이 있거나 자리가 모자라면 -1
+static int encode_args(unsigned char *buf, size_t size, const char *format, va_list args) {
+    unsigned char       *out = buf;
+    const unsigned char *end = buf + size;
+
+    for (const char *p = format; *p; p++) {
+        if (*p != '%')
+            continue;
+        if (*++p == '%')
+            continue;
+
+        while (*p && strchr("-+ #0'", *p))
+            p++;
+
+        // 너비
+        if (*p == '*') {
+            if (!put_int(&out, end, va_arg(args, int)))
+                return -1;
+            p++;
+        }
+        while (*p >= '0' && *p <= '9')
+            p++;
+
+        // 정밀도 (%s는 정밀도만큼만 복사한다)
+        int precision = -1;
+        if (*p == '.') {
+            p++;
+            if (*p == '*') {
+                precision = va_arg(args, int);
+                if (!put_int(&out, end, precision))
+                    return -1;
+                p++;
+            } else {
+                precision = 0;
+                while (*p >= '0' && *p <= '9')
+                    precision = precision * 10 + (*p++ - '0');
+            }
+        }
+
+        // 길이 수식어
+        enum { LEN_NONE, LEN_HH, LEN_H, LEN_L, LEN_LL, LEN_Z, LEN_J, LEN_T, LEN_LD } len = LEN_NONE;
+        switch (*p) {
+            case 'h':
+                len = (p[1] == 'h') ? LEN_HH : LEN_H;
+                p += (len == LEN_HH) ? 2 : 1;
+                break;
+            case 'l':
+                len = (p[1] == 'l') ? LEN_LL : LEN_L;
+                p += (len == LEN_LL) ? 2 : 1;
+                break;
+            case 'z':
+                len = LEN_Z;
+                p++;
+                break;
+            case 'j':
+                len = LEN_J;
+                p++;
+                break;
+            case 't':
+                len = LEN_T;
+                p++;
+                break;
+            case 'L':
+                len = LEN_LD;
+                p++;
+                break;
+        }
+
+        bool ok;
+        switch (*p) {
+            case 'd':
+            case 'i':
+            case 'c': {
+                int64_t v;
+                switch (len) {
+                    case LEN_HH:
+                        v = (signed char)va_arg(args, int);
+                        break;
+                    case LEN_H:
+                        v = (short)va_arg(args, int);
+                        break;
+                    case LEN_L:
+                        v = va_arg(args, long);
+                        break;
+                    case LEN_LL:
+                        v = va_arg(args, long long);
+                        break;
+                    case LEN_Z:
+                        v = va_arg(args, ssize_t);
+                        break;
+                    case LEN_J:
+                        v = va_arg(args, intmax_t);
+                        break;
+                    case LEN_T:
+                        v = va_arg(args, ptrdiff_t);
+                        break;
+                    default:
+                        v = va_arg(args, int);
+                        break;
+                }
+                ok = put_int(&out, end, v);
+                break;
+            }
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o': {
+                uint64_t v;
+                switch (len) {
+                    case LEN_HH:
+                        v = (unsigned char)va_arg(args, unsigned);
+                        break;
+                    case LEN_H:
+                        v = (unsigned short)va_arg(args, unsigned);
+                        break;
+                    case LEN_L:
+                        v = va_arg(args, unsigned long);
+                        break;
+                    case LEN_LL:
+                        v = va_arg(args, unsigned long long);
+                        break;
+                    case LEN_Z:
+                        v = va_arg(args, size_t);
+                        break;
+                    case LEN_J:
+                        v = va_arg(args, uintmax_t);
+                        break;
+                    case LEN_T:
+                        v = (uint64_t)va_arg(args, ptrdiff_t);
+                        break;
+                    default:
+                        v = va_arg(args, unsigned);
+                        break;
+                }
+                ok = put_arg(&out, end, LOG_ARG_UINT, &v, sizeof(v));
+                break;
+            }
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A': {
+                double v = (len == LEN_LD) ? (double)va_arg(args, long double) : va_arg(args, double);
+                ok       = put_arg(&out, end, LOG_ARG_DOUBLE, &v, sizeof(v));
+                break;
+            }
+            case 's': {
+                const char *str = va_arg(args, const char *);
+                if (!str)
+                    str = "(null)";
+                size_t room = (size_t)(end - out);
+                if (room < 1 + sizeof(uint16_t))
+                    return -1;
+                size_t n = strnlen(str, precision >= 0 ? (size_t)precision : room - 1 - sizeof(uint16_t));
+                if (n > room - 1 - sizeof(uint16_t))
+                    return -1;
+                uint16_t n16 = (uint16_t)n;
+                *out++       = LOG_ARG_STRING;
+                memcpy(out, &n16, sizeof(n16));
+                memcpy(out + sizeof(n16), str, n);
+                out += sizeof(n16) + n;
+                ok = true;
+                break;
+            }
+            case 'p': {
+                uint64_t v = (uint64_t)(uintptr_t)va_arg(args, void *);
+                ok         = put_arg(&out, end, LOG_ARG_POINTER, &v, sizeof(v));
+                break;
+            }
+            default:
+                return -1;
+        }
+        if (!ok)
+            return -1;
     }
+    return (int)(out - buf);
+}
 
-    // 메시지 포맷팅
-    char    message[1024];
+// 로그 메시지 기록 (호출 스레드의 링에 넣고 바로 반환, 링이 가득 차면 버린다)
+void log_message(log_level_t level, const char *file, int line, const char *func, const char *format, ...) {
     va_list args;
-    va_start(args, format);
-    vsnprintf(message, sizeof(message), format, args);
-    va_end(args);
 
-    if (output_type == LOG_OUTPUT_FILE && log_file != NULL) {
-        // 파일 출력 (클라이언트용)
-        fprintf(log_file, "[%s] [%s] %s:%d %s() - %s\n",
-                timestamp, log_level_strings[level], filename, line, func, message);
-    } else if (output_type == LOG_OUTPUT_CONSOLE) {
-        // 콘솔 출력 (서버용, 색상 적용)
-        print_colored_console_log(level, timestamp, filename, line, func, message);
+    // 매크로를 거치지 않은 직접 호출도 같은 기준으로 거른다
+    if (!log_level_enabled(level))
+        return;
+
+    if (!atomic_load_explicit(&g_logger.running, memory_order_acquire)) {
+        struct {
+            log_record_t rec;
+            char         message[LOG_MESSAGE_MAX];
+        } local = {.rec = {.file = file, .func = func, .line = line, .level = level}};
+
+        clock_wall_timespec(&local.rec.ts);
+        va_start(args, format);
+        int n = vsnprintf(local.message, sizeof(local.message), format, args);
+        va_end(args);
+        local.rec.length = n < 0 ? 0 : (n >= LOG_MESSAGE_MAX ? LOG_MESSAGE_MAX - 1 : n);
+        write_sync(&local.rec, local.message);
+        return;
     }
 
-    pthread_mutex_unlock(&log_mutex);
+    log_ring_t *ring = thread_ring();
+    if (!ring) {
+        atomic_fetch_add_explicit(&g_logger.no_ring, 1, memory_order_relaxed);
+        return;
+    }
+    if (ring->busy) {
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return;
+    }
+    ring->busy = 1;
+
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    size_t skip = ring_skip(head);
+    if (LOG_RING_SIZE - (head - tail) < skip + LOG_RECORD_MAX) {
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        ring->busy = 0;
+        return;
+    }
+
+    // 최대 크기 자리를 확보했으므로 링 안에 바로 기록한다
+    log_record_t *rec = (log_record_t *)(ring->buf + ((head + skip) & (LOG_RING_SIZE - 1)));
+    rec->file         = file;
+    rec->func         = func;
+    rec->format       = format;
+    rec->line         = line;
+    rec->level        = level;
+
+    int n = -1;
+    if (g_logger.output_type == LOG_OUTPUT_BINARY) {
+        // 포맷하지 않고 인자만 옮긴다 (문자열은 라이터가 읽을 때 사라질 수 있어 복사)
+        clock_gettime(CLOCK_MONOTONIC, &rec->ts);
+        va_start(args, format);
+        n = encode_args((unsigned char *)(rec + 1), LOG_MESSAGE_MAX, format, args);
+        va_end(args);
+    } else {
+        // 텍스트는 초 단위로만 찍으므로 캐시된 시각으로 충분하다
+        clock_wall_timespec(&rec->ts);
+    }
+
+    if (n < 0) {
+        va_start(args, format);
+        n = vsnprintf((char *)(rec + 1), LOG_MESSAGE_MAX, format, args);
+        va_end(args);
+        n           = n < 0 ? 0 : (n >= LOG_MESSAGE_MAX ? LOG_MESSAGE_MAX - 1 : n);
+        rec->format = NULL;
+    }
+    rec->length = (uint16_t)n;
+
+    atomic_store_explicit(&ring->head, head + skip + record_size(rec), memory_order_release);
+    ring->busy = 0;
 }
 
 // perror와 유사한 로그 함수
 void log_perror(const char *message) {
     LOG_ERROR("%s: %s", message, strerror(errno));
-}
\ No newline at end of file
+}
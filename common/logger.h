@@ -3,6 +3,7 @@
 
 #include <errno.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
@@ -17,10 +18,16 @@ typedef enum {
     LOG_FATAL = 4
 } log_level_t;
 
+// 빌드 시 최소 로그 레벨 (예: -DLOG_COMPILE_LEVEL=1 이면 LOG_DEBUG 호출이 코드에서 빠진다)
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL 0
+#endif
+
 // 로그 출력 타입
 typedef enum {
-    LOG_OUTPUT_FILE,    // 파일 출력 (클라이언트용)
-    LOG_OUTPUT_CONSOLE  // 콘솔 출력 (서버용)
+    LOG_OUTPUT_FILE,     // 파일 출력 (클라이언트용)
+    LOG_OUTPUT_CONSOLE,  // 콘솔 출력 (서버용)
+    LOG_OUTPUT_BINARY    // 바이너리 파일 출력 (logs/<prefix>_<pid>.blog, logdecode로 해석)
 } log_output_type_t;
 
 // 모듈별 로깅을 위한 모듈 ID
@@ -39,6 +46,20 @@ typedef enum {
 int  logger_init(log_output_type_t output_type, const char *file_path_or_prefix);
 void logger_cleanup(void);
 
+// 실행 중 최소 로그 레벨 (기본 LOG_DEBUG, 매크로가 인자 평가와 포맷 전에 확인)
+extern atomic_int g_log_level;
+
+void        logger_set_level(log_level_t level);
+log_level_t logger_get_level(void);
+// "debug", "info", "warn", "error", "fatal" 또는 0~4 (실패 시 -1)
+int logger_parse_level(const char *name);
+// "DEBUG" ... "FATAL"
+const char *logger_level_name(log_level_t level);
+
+static inline bool log_level_enabled(log_level_t level) {
+    return (int)level >= atomic_load_explicit(&g_log_level, memory_order_relaxed);
+}
+
 // 로그 함수들
 void log_message(log_level_t level, const char *file, int line, const char *func, const char *format, ...);
 void log_perror(const char *message);
@@ -50,12 +71,19 @@ log_level_t logger_get_module_level(log_module_t module);
 // 모듈별 로그 함수
 void log_module_message(log_module_t module, log_level_t level, const char *file, int line, const char *func, const char *format, ...);
 
+// 레벨 확인 후 기록 (빌드 레벨 미만이면 if (0)이 되어 인자 타입 검사만 남고 코드는 생성되지 않는다)
+#define LOG_AT(level, ...)                                                 \
+    do {                                                                   \
+        if ((level) >= LOG_COMPILE_LEVEL && log_level_enabled(level))      \
+            log_message(level, __FILE__, __LINE__, __func__, __VA_ARGS__); \
+    } while (0)
+
 // 편의 매크로들
-#define LOG_DEBUG(...) log_message(LOG_DEBUG, __FILE__, __LINE__, __func__, __VA_ARGS__)
-#define LOG_INFO(...)  log_message(LOG_INFO, __FILE__, __LINE__, __func__, __VA_ARGS__)
-#define LOG_WARN(...)  log_message(LOG_WARN, __FILE__, __LINE__, __func__, __VA_ARGS__)
-#define LOG_ERROR(...) log_message(LOG_ERROR, __FILE__, __LINE__, __func__, __VA_ARGS__)
-#define LOG_FATAL(...) log_message(LOG_FATAL, __FILE__, __LINE__, __func__, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_AT(LOG_DEBUG, __VA_ARGS__)
+#define LOG_INFO(...)  LOG_AT(LOG_INFO, __VA_ARGS__)
+#define LOG_WARN(...)  LOG_AT(LOG_WARN, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_AT(LOG_ERROR, __VA_ARGS__)
+#define LOG_FATAL(...) LOG_AT(LOG_FATAL, __VA_ARGS__)
 
 // 성능 측정을 위한 매크로
 #define LOG_PERF_START(name)            \
@@ -0,0 +1,253 @@
+#include "metrics.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "logger.h"
+#include "message.pb-c.h"
+
+// 수 처리 시간 버킷 (마이크로초)
+static const uint64_t move_latency_bounds_us[] = {
+    100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000};
+
+_Static_assert(sizeof(move_latency_bounds_us) / sizeof(move_latency_bounds_us[0]) <= METRIC_HISTOGRAM_MAX_BUCKETS,
+               "too many histogram buckets");
+
+metrics_t g_metrics = {
+    .move_latency = {
+        .bounds_us = move_latency_bounds_us,
+        .n_bounds  = sizeof(move_latency_bounds_us) / sizeof(move_latency_bounds_us[0]),
+    },
+};
+
+void metric_histogram_observe(metric_histogram_t *h, uint64_t value_us) {
+    int i = 0;
+    while (i < h->n_bounds && value_us > h->bounds_us[i])
+        i++;
+    atomic_fetch_add_explicit(&h->buckets[i], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&h->count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&h->sum_us, value_us, memory_order_relaxed);
+}
+
+// 값 → 칸 번호: 16 미만은 그대로, 그 위는 (지수, 상위 4비트)로 나눈다
+static int hdr_index(uint64_t v) {
+    if (v < METRIC_HDR_SUB_COUNT)
+        return (int)v;
+    int exp = 63 - __builtin_clzll(v);
+    if (exp >= METRIC_HDR_MAX_EXP)
+        return METRIC_HDR_BUCKETS - 1;
+    int sub = (int)(v >> (exp - METRIC_HDR_SUB_BITS)) - METRIC_HDR_SUB_COUNT;
+    return (exp - METRIC_HDR_SUB_BITS + 1) * METRIC_HDR_SUB_COUNT + sub;
+}
+
+// 칸 번호 → 그 칸에 들어가는 가장 큰 값
+static uint64_t hdr_upper_bound(int index) {
+    if (index < METRIC_HDR_SUB_COUNT)
+        return (uint64_t)index;
+    int      exp   = index / METRIC_HDR_SUB_COUNT + METRIC_HDR_SUB_BITS - 1;
+    int      sub   = index % METRIC_HDR_SUB_COUNT;
+    uint64_t width = 1ull << (exp - METRIC_HDR_SUB_BITS);
+    return ((uint64_t)(METRIC_HDR_SUB_COUNT + sub) << (exp - METRIC_HDR_SUB_BITS)) + width - 1;
+}
+
+void metric_hdr_record(metric_hdr_t *h, uint64_t value_ns) {
+    atomic_fetch_add_explicit(&h->buckets[hdr_index(value_ns)], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&h->count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&h->sum_ns, value_ns, memory_order_relaxed);
+
+    unsigned long long max = atomic_load_explicit(&h->max_ns, memory_order_relaxed);
+    while (value_ns > max &&
+           !atomic_compare_exchange_weak_explicit(&h->max_ns, &max, value_ns, memory_order_relaxed, memory_order_relaxed))
+        ;
+}
+
+uint64_t metric_hdr_quantile(metric_hdr_t *h, double q) {
+    // 기록 중에도 읽을 수 있도록 칸 합계로 총수를 다시 센다
+    unsigned long long total = 0;
+    for (int i = 0; i < METRIC_HDR_BUCKETS; i++)
+        total += atomic_load_explicit(&h->buckets[i], memory_order_relaxed);
+    if (total == 0)
+        return 0;
+
+    unsigned long long rank = (unsigned long long)(q * (double)total + 0.5);
+    if (rank < 1)
+        rank = 1;
+    if (rank > total)
+        rank = total;
+
+    uint64_t           max  = atomic_load_explicit(&h->max_ns, memory_order_relaxed);
+    unsigned long long seen = 0;
+    for (int i = 0; i < METRIC_HDR_BUCKETS; i++) {
+        seen += atomic_load_explicit(&h->buckets[i], memory_order_relaxed);
+        if (seen >= rank) {
+            uint64_t bound = hdr_upper_bound(i);
+            return bound < max ? bound : max;
+        }
+    }
+    return max;
+}
+
+__thread metrics_dispatch_scope_t t_dispatch_scope;
+
+void metrics_dispatch_begin(void) {
+    t_dispatch_scope = (metrics_dispatch_scope_t){.active = true, .start_ns = metrics_now_ns()};
+}
+
+uint64_t metrics_dispatch_end(int msg_case) {
+    uint64_t total   = metrics_now_ns() - t_dispatch_scope.start_ns;
+    uint64_t waited  = t_dispatch_scope.lock_wait_ns;
+    uint64_t sent    = t_dispatch_scope.send_ns;
+    uint64_t compute = total > waited + sent ? total - waited - sent : 0;
+
+    t_dispatch_scope.active = false;
+
+    if (msg_case < 0 || msg_case >= METRICS_MAX_MSG_CASE)
+        msg_case = 0;
+    metric_hdr_t *phases = g_metrics.dispatch[msg_case];
+    metric_hdr_record(&phases[METRIC_PHASE_LOCK_WAIT], waited);
+    metric_hdr_record(&phases[METRIC_PHASE_COMPUTE], compute);
+    metric_hdr_record(&phases[METRIC_PHASE_SEND], sent);
+    return total;
+}
+
+void metrics_count_message_in(int msg_case) {
+    if (msg_case < 0 || msg_case >= METRICS_MAX_MSG_CASE)
+        msg_case = 0;
+    metric_inc(&g_metrics.messages_in[msg_case]);
+}
+
+// 출력 버퍼 (넘치면 이후 출력은 버린다)
+typedef struct {
+    char  *buf;
+    size_t size;
+    size_t len;
+} render_buf_t;
+
+static void emit(render_buf_t *r, const char *format, ...) {
+    if (r->len + 1 >= r->size)
+        return;
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(r->buf + r->len, r->size - r->len, format, args);
+    va_end(args);
+    if (n > 0)
+        r->len += ((size_t)n < r->size - r->len) ? (size_t)n : r->size - r->len - 1;
+}
+
+static void emit_header(render_buf_t *r, const char *name, const char *type, const char *help) {
+    emit(r, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+static void emit_counter(render_buf_t *r, const char *name, const char *help, metric_counter_t *c) {
+    emit_header(r, name, "counter", help);
+    emit(r, "%s %llu\n", name, atomic_load_explicit(&c->value, memory_order_relaxed));
+}
+
+static void emit_gauge(render_buf_t *r, const char *name, const char *help, metric_gauge_t *g) {
+    emit_header(r, name, "gauge", help);
+    emit(r, "%s %lld\n", name, atomic_load_explicit(&g->value, memory_order_relaxed));
+}
+
+static void emit_histogram(render_buf_t *r, const char *name, const char *help, metric_histogram_t *h) {
+    emit_header(r, name, "histogram", help);
+    unsigned long long cumulative = 0;
+    for (int i = 0; i <= h->n_bounds; i++) {
+        cumulative += atomic_load_explicit(&h->buckets[i], memory_order_relaxed);
+        if (i < h->n_bounds)
+            emit(r, "%s_bucket{le=\"%g\"} %llu\n", name, h->bounds_us[i] / 1e6, cumulative);
+        else
+            emit(r, "%s_bucket{le=\"+Inf\"} %llu\n", name, cumulative);
+    }
+    emit(r, "%s_sum %.6f\n", name, atomic_load_explicit(&h->sum_us, memory_order_relaxed) / 1e6);
+    emit(r, "%s_count %llu\n", name, cumulative);
+}
+
+// msg_case → oneof 필드 이름 (모르는 값이면 NULL)
+static const char *msg_case_name(int msg_case) {
+    for (unsigned i = 0; i < client_message__descriptor.n_fields; i++) {
+        const ProtobufCFieldDescriptor *field = &client_message__descriptor.fields[i];
+        if ((field->flags & PROTOBUF_C_FIELD_FLAG_ONEOF) && field->id == (uint32_t)msg_case)
+            return field->name;
+    }
+    return NULL;
+}
+
+static const char *const phase_names[METRIC_PHASE_COUNT] = {
+    [METRIC_PHASE_LOCK_WAIT] = "lock_wait",
+    [METRIC_PHASE_COMPUTE]   = "compute",
+    [METRIC_PHASE_SEND]      = "send",
+};
+
+static const double summary_quantiles[] = {0.5, 0.9, 0.99, 0.999, 1.0};
+
+// 디스패치 시간은 칸이 많아 히스토그램 대신 분위수 요약으로 내보낸다 (1.0은 최댓값)
+static void emit_dispatch_summary(render_buf_t *r) {
+    const char *name = "chess_dispatch_seconds";
+    emit_header(r, name, "summary", "Dispatch time by message type and phase.");
+    for (int mc = 0; mc < METRICS_MAX_MSG_CASE; mc++) {
+        const char *type = msg_case_name(mc);
+        if (!type)
+            continue;
+        for (int p = 0; p < METRIC_PHASE_COUNT; p++) {
+            metric_hdr_t      *h     = &g_metrics.dispatch[mc][p];
+            unsigned long long count = atomic_load_explicit(&h->count, memory_order_relaxed);
+            if (count == 0)
+                continue;
+            for (size_t i = 0; i < sizeof(summary_quantiles) / sizeof(summary_quantiles[0]); i++)
+                emit(r, "%s{type=\"%s\",phase=\"%s\",quantile=\"%g\"} %.9f\n", name, type, phase_names[p],
+                     summary_quantiles[i], metric_hdr_quantile(h, summary_quantiles[i]) / 1e9);
+            emit(r, "%s_sum{type=\"%s\",phase=\"%s\"} %.9f\n", name, type, phase_names[p],
+                 atomic_load_explicit(&h->sum_ns, memory_order_relaxed) / 1e9);
+            emit(r, "%s_count{type=\"%s\",phase=\"%s\"} %llu\n", name, type, phase_names[p], count);
+        }
+    }
+}
+
+size_t metrics_render(char *out, size_t size) {
+    render_buf_t r = {.buf = out, .size = size, .len = 0};
+    if (size == 0)
+        return 0;
+    out[0] = '\0';
+
+    // 메시지 종류 이름은 oneof 필드 이름을 그대로 쓴다
+    emit_header(&r, "chess_messages_received_total", "counter", "Client messages received, by message type.");
+    for (int mc = 0; mc < METRICS_MAX_MSG_CASE; mc++) {
+        const char *type = msg_case_name(mc);
+        if (type)
+            emit(&r, "chess_messages_received_total{type=\"%s\"} %llu\n", type,
+                 atomic_load_explicit(&g_metrics.messages_in[mc].value, memory_order_relaxed));
+    }
+
+    emit_counter(&r, "chess_messages_sent_total", "Messages sent to peers.", &g_metrics.messages_out);
+    emit_counter(&r, "chess_received_bytes_total", "Bytes received, including length prefixes.", &g_metrics.bytes_in);
+    emit_counter(&r, "chess_sent_bytes_total", "Bytes sent, including length prefixes.", &g_metrics.bytes_out);
+    emit_counter(&r, "chess_connections_total", "Client connections accepted.", &g_metrics.connections);
+    emit_counter(&r, "chess_disconnects_total", "Client connections closed.", &g_metrics.disconnects);
+    emit_counter(&r, "chess_game_timeouts_total", "Games ended because a clock ran out.", &g_metrics.timeouts);
+    emit_gauge(&r, "chess_connected_clients", "Currently connected clients.", &g_metrics.connected_clients);
+    emit_gauge(&r, "chess_active_games", "Games in progress.", &g_metrics.active_games);
+    emit_gauge(&r, "chess_waiting_players", "Players waiting for a match.", &g_metrics.waiting_players);
+    emit_histogram(&r, "chess_move_latency_seconds", "Time to handle a move message.", &g_metrics.move_latency);
+    emit_dispatch_summary(&r);
+
+    return r.len;
+}
+
+void metrics_log_dispatch_latency(void) {
+    for (int mc = 0; mc < METRICS_MAX_MSG_CASE; mc++) {
+        const char *type = msg_case_name(mc);
+        if (!type)
+            continue;
+        for (int p = 0; p < METRIC_PHASE_COUNT; p++) {
+            metric_hdr_t      *h     = &g_metrics.dispatch[mc][p];
+            unsigned long long count = atomic_load_explicit(&h->count, memory_order_relaxed);
+            if (count == 0)
+                continue;
+            LOG_INFO("Dispatch latency %s/%s: n=%llu p50=%.1fus p90=%.1fus p99=%.1fus p99.9=%.1fus max=%.1fus",
+                     type, phase_names[p], count,
+                     metric_hdr_quantile(h, 0.5) / 1e3, metric_hdr_quantile(h, 0.9) / 1e3,
+                     metric_hdr_quantile(h, 0.99) / 1e3, metric_hdr_quantile(h, 0.999) / 1e3,
+                     atomic_load_explicit(&h->max_ns, memory_order_relaxed) / 1e3);
+        }
+    }
+}
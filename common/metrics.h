@@ -0,0 +1,144 @@
+#ifndef COMMON_METRICS_H
+#define COMMON_METRICS_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+// 메트릭 레지스트리
+// 어느 스레드에서든 relaxed 원자 연산으로 갱신하고, 스크레이프 때 Prometheus 텍스트 형식으로 읽는다
+
+typedef struct {
+    atomic_ullong value;
+} metric_counter_t;
+
+typedef struct {
+    atomic_llong value;
+} metric_gauge_t;
+
+// 고정 버킷 히스토그램 (값은 마이크로초, 출력은 Prometheus 관례대로 초)
+#define METRIC_HISTOGRAM_MAX_BUCKETS 16
+
+typedef struct {
+    const uint64_t *bounds_us;  // 오름차순 버킷 상한 (그 뒤는 +Inf)
+    int             n_bounds;
+    atomic_ullong   buckets[METRIC_HISTOGRAM_MAX_BUCKETS + 1];  // 버킷별 개수 (출력할 때 누적)
+    atomic_ullong   count;
+    atomic_ullong   sum_us;
+} metric_histogram_t;
+
+// HDR 방식 로그-선형 히스토그램 (값은 나노초)
+// 2의 거듭제곱 구간을 16칸으로 나눠 어느 크기에서든 상대 오차가 1/16 이내다
+#define METRIC_HDR_SUB_BITS  4
+#define METRIC_HDR_SUB_COUNT (1 << METRIC_HDR_SUB_BITS)
+#define METRIC_HDR_MAX_EXP   36  // 2^36ns (약 69초) 이상은 마지막 칸에 모은다
+#define METRIC_HDR_BUCKETS   ((METRIC_HDR_MAX_EXP - METRIC_HDR_SUB_BITS + 1) * METRIC_HDR_SUB_COUNT)
+
+typedef struct {
+    atomic_ullong buckets[METRIC_HDR_BUCKETS];
+    atomic_ullong count;
+    atomic_ullong sum_ns;
+    atomic_ullong max_ns;
+} metric_hdr_t;
+
+// ClientMessage.msg_case 범위 (oneof 필드 번호)
+#define METRICS_MAX_MSG_CASE 32
+
+// 디스패치 시간을 나누는 구간
+typedef enum {
+    METRIC_PHASE_LOCK_WAIT,  // g_match_manager.mutex를 기다린 시간
+    METRIC_PHASE_COMPUTE,    // 나머지 (핸들러 자체 처리)
+    METRIC_PHASE_SEND,       // send_all 안에서 보낸 시간
+    METRIC_PHASE_COUNT
+} metric_phase_t;
+
+typedef struct {
+    metric_counter_t   messages_in[METRICS_MAX_MSG_CASE];  // 받은 ClientMessage (msg_case별)
+    metric_counter_t   messages_out;                       // 보낸 메시지
+    metric_counter_t   bytes_in;                           // 길이 머리 포함
+    metric_counter_t   bytes_out;
+    metric_counter_t   connections;                        // 받아들인 연결
+    metric_counter_t   disconnects;                        // 끊긴 연결
+    metric_counter_t   timeouts;                           // 시간 초과로 끝난 게임
+    metric_gauge_t     connected_clients;
+    metric_gauge_t     active_games;                       // 스크레이프 때 매칭 매니저에서 채운다
+    metric_gauge_t     waiting_players;                    // 스크레이프 때 매칭 매니저에서 채운다
+    metric_histogram_t move_latency;                       // MOVE 메시지 처리 시간 (수신 후 디스패치 완료까지)
+
+    // msg_case별 디스패치 시간 (구간별)
+    metric_hdr_t dispatch[METRICS_MAX_MSG_CASE][METRIC_PHASE_COUNT];
+} metrics_t;
+
+extern metrics_t g_metrics;
+
+// 이 스레드에서 진행 중인 디스패치의 구간별 누적 시간
+// 디스패치 밖(타이머 스레드, 워커 등)에서는 active가 false라 시계를 읽지 않는다
+typedef struct {
+    bool     active;
+    uint64_t start_ns;
+    uint64_t lock_wait_ns;
+    uint64_t send_ns;
+} metrics_dispatch_scope_t;
+
+extern __thread metrics_dispatch_scope_t t_dispatch_scope;
+
+static inline uint64_t metrics_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// 디스패치 중일 때만 시작 시각을 돌려준다 (0이면 재지 않음)
+static inline uint64_t metrics_phase_begin(void) {
+    return t_dispatch_scope.active ? metrics_now_ns() : 0;
+}
+
+static inline void metrics_lock_wait_end(uint64_t start_ns) {
+    if (start_ns)
+        t_dispatch_scope.lock_wait_ns += metrics_now_ns() - start_ns;
+}
+
+static inline void metrics_send_end(uint64_t start_ns) {
+    if (start_ns)
+        t_dispatch_scope.send_ns += metrics_now_ns() - start_ns;
+}
+
+static inline void metric_inc(metric_counter_t *c) {
+    atomic_fetch_add_explicit(&c->value, 1, memory_order_relaxed);
+}
+
+static inline void metric_add(metric_counter_t *c, uint64_t n) {
+    atomic_fetch_add_explicit(&c->value, n, memory_order_relaxed);
+}
+
+static inline void metric_gauge_set(metric_gauge_t *g, int64_t v) {
+    atomic_store_explicit(&g->value, v, memory_order_relaxed);
+}
+
+static inline void metric_gauge_add(metric_gauge_t *g, int64_t delta) {
+    atomic_fetch_add_explicit(&g->value, delta, memory_order_relaxed);
+}
+
+void metric_histogram_observe(metric_histogram_t *h, uint64_t value_us);
+
+void metric_hdr_record(metric_hdr_t *h, uint64_t value_ns);
+
+// q (0~1) 분위수의 근사값 (해당 칸의 상한, 최댓값을 넘지 않는다), 기록이 없으면 0
+uint64_t metric_hdr_quantile(metric_hdr_t *h, double q);
+
+// 디스패치 구간 측정 시작/끝, 끝은 전체 소요 시간(나노초)을 돌려준다
+void     metrics_dispatch_begin(void);
+uint64_t metrics_dispatch_end(int msg_case);
+
+// msg_case별 디스패치 시간 요약을 로그로 남긴다 (종료 시 호출)
+void metrics_log_dispatch_latency(void);
+
+// 받은 메시지 수 (범위 밖의 msg_case는 0번 칸에 모은다)
+void metrics_count_message_in(int msg_case);
+
+// Prometheus 텍스트 형식 (0.0.4)으로 out에 쓴다, 반환값은 쓴 길이 (모자라면 잘린다)
+size_t metrics_render(char *out, size_t size);
+
+#endif  // COMMON_METRICS_H
@@ -0,0 +1,70 @@
+// move.c
+#include "move.h"
+
+#include <ctype.h>
+#include <string.h>
+
+// 프로모션 기물 문자 (move_t의 프로모션 비트 순서)
+static const char promotion_chars[4] = {'n', 'b', 'r', 'q'};
+
+bool square_parse(const char *coord, int *x, int *y) {
+    if (!coord || coord[0] < 'a' || coord[0] > 'h' || coord[1] < '1' || coord[1] > '8' || coord[2] != '\0')
+        return false;
+
+    *x = coord[0] - 'a';  // file (0-7)
+    *y = coord[1] - '1';  // rank (0-7)
+    return true;
+}
+
+void square_format(int x, int y, char *coord) {
+    coord[0] = 'a' + x;
+    coord[1] = '1' + y;
+    coord[2] = '\0';
+}
+
+bool move_parse(const char *str, move_t *out) {
+    if (!str)
+        return false;
+
+    size_t len = strlen(str);
+    if (len != 4 && len != 5)
+        return false;
+
+    char from[3] = {str[0], str[1], '\0'};
+    char to[3]   = {str[2], str[3], '\0'};
+    int  sx, sy, dx, dy;
+    if (!square_parse(from, &sx, &sy) || !square_parse(to, &dx, &dy))
+        return false;
+
+    if (len == 4) {
+        *out = move_make(sx, sy, dx, dy);
+        return true;
+    }
+
+    // 프로모션 접미사 (e7e8q)
+    for (int i = 0; i < 4; i++) {
+        if (tolower((unsigned char)str[4]) == promotion_chars[i]) {
+            *out = move_make_flag(sx, sy, dx, dy, MOVE_FLAG_PROMOTION, (piece_type_t)(PIECE_KNIGHT + i));
+            return true;
+        }
+    }
+    return false;
+}
+
+bool move_parse_squares(const char *from, const char *to, move_t *out) {
+    int sx, sy, dx, dy;
+    if (!square_parse(from, &sx, &sy) || !square_parse(to, &dx, &dy))
+        return false;
+
+    *out = move_make(sx, sy, dx, dy);
+    return true;
+}
+
+void move_format(move_t m, char *out) {
+    square_format(move_from_x(m), move_from_y(m), out);
+    square_format(move_to_x(m), move_to_y(m), out + 2);
+    if (move_flag(m) == MOVE_FLAG_PROMOTION) {
+        out[4] = promotion_chars[move_promotion(m) - PIECE_KNIGHT];
+        out[5] = '\0';
+    }
+}
@@ -0,0 +1,86 @@
+// move.h
+#ifndef COMMON_MOVE_H
+#define COMMON_MOVE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "types.h"
+
+// 16비트 수 표현 (규칙 엔진, 서버 핸들러, PGN, 리플레이 공통)
+//   bit  0-5  : 출발 칸 (rank * 8 + file)
+//   bit  6-11 : 도착 칸
+//   bit 12-13 : 프로모션 기물 (0=나이트, 1=비숍, 2=룩, 3=퀸)
+//   bit 14-15 : 특수 수 플래그 (move_flag_t)
+typedef uint16_t move_t;
+
+// a1a1은 실제 수가 될 수 없으므로 "수 없음"으로 사용
+#define MOVE_NONE ((move_t)0)
+
+// 좌표 표기 문자열 버퍼 크기 ("e7e8q" + NUL)
+#define MOVE_STR_LEN 6
+
+// 특수 수 플래그
+// 생성기가 채워 주는 정보이며, apply_move는 보드를 보고 판단하므로
+// 문자열에서 파싱한 수(플래그 NORMAL)도 그대로 적용할 수 있다
+typedef enum {
+    MOVE_FLAG_NORMAL     = 0,
+    MOVE_FLAG_PROMOTION  = 1,
+    MOVE_FLAG_EN_PASSANT = 2,
+    MOVE_FLAG_CASTLING   = 3
+} move_flag_t;
+
+// 칸 번호 <-> (file, rank)
+#define SQUARE(x, y) ((y) * 8 + (x))
+#define SQUARE_X(sq) ((sq) & 7)
+#define SQUARE_Y(sq) ((sq) >> 3)
+
+// 칸 번호로 수 만들기
+static inline move_t move_make_sq(int from, int to, move_flag_t flag, piece_type_t promotion) {
+    int promo_bits = (flag == MOVE_FLAG_PROMOTION) ? (promotion - PIECE_KNIGHT) & 3 : 0;
+    return (move_t)(from | (to << 6) | (promo_bits << 12) | ((int)flag << 14));
+}
+
+static inline move_t move_make_flag(int sx, int sy, int dx, int dy, move_flag_t flag, piece_type_t promotion) {
+    return move_make_sq(SQUARE(sx, sy), SQUARE(dx, dy), flag, promotion);
+}
+
+static inline move_t move_make(int sx, int sy, int dx, int dy) {
+    return move_make_flag(sx, sy, dx, dy, MOVE_FLAG_NORMAL, PIECE_PAWN);
+}
+
+static inline int move_from(move_t m) { return m & 0x3f; }
+static inline int move_to(move_t m) { return (m >> 6) & 0x3f; }
+static inline int move_from_x(move_t m) { return SQUARE_X(move_from(m)); }
+static inline int move_from_y(move_t m) { return SQUARE_Y(move_from(m)); }
+static inline int move_to_x(move_t m) { return SQUARE_X(move_to(m)); }
+static inline int move_to_y(move_t m) { return SQUARE_Y(move_to(m)); }
+
+static inline move_flag_t move_flag(move_t m) { return (move_flag_t)((m >> 14) & 3); }
+
+// 프로모션 기물 (MOVE_FLAG_PROMOTION일 때만 의미 있음)
+static inline piece_type_t move_promotion(move_t m) {
+    return (piece_type_t)(PIECE_KNIGHT + ((m >> 12) & 3));
+}
+
+// 출발/도착 칸만 비교 (플래그 유무와 상관없이 같은 수인지 확인)
+static inline bool move_same_squares(move_t a, move_t b) {
+    return (a & 0x0fff) == (b & 0x0fff);
+}
+
+// "e2" -> (4, 1), 실패 시 false
+bool square_parse(const char *coord, int *x, int *y);
+
+// (4, 1) -> "e2" (coord는 3바이트 이상)
+void square_format(int x, int y, char *coord);
+
+// "e2e4", "e7e8q" 형식 파싱, 실패 시 false
+bool move_parse(const char *str, move_t *out);
+
+// MoveRequest/MoveBroadcast의 from, to 문자열 한 쌍을 파싱
+bool move_parse_squares(const char *from, const char *to, move_t *out);
+
+// 좌표 표기로 출력 (out은 MOVE_STR_LEN 이상)
+void move_format(move_t m, char *out);
+
+#endif  // COMMON_MOVE_H
@@ -7,7 +7,10 @@
 #include <string.h>
 #include <unistd.h>
 
+#include "capture.h"
 #include "logger.h"
+#include "metrics.h"
+#include "trace.h"
 
 // 모든 데이터를 전송할 때까지 반복하여 전송한다
 ssize_t send_all(int sockfd, const void *buf, size_t len) {
@@ -58,12 +61,16 @@ int send_client_message(int fd, ClientMessage *msg) {
     client_message__pack(msg, sb + 4);
 
     LOG_DEBUG("Sending message to fd=%d, size=%zu bytes", fd, plen);
-    int result = send_all(fd, sb, 4 + plen);
+    uint64_t send_start = metrics_phase_begin();
+    int      result     = send_all(fd, sb, 4 + plen);
+    metrics_send_end(send_start);
     free(sb);
 
     if (result < 0) {
         LOG_ERROR("Failed to send message to fd=%d", fd);
     } else {
+        metric_inc(&g_metrics.messages_out);
+        metric_add(&g_metrics.bytes_out, (uint64_t)result);
         LOG_DEBUG("Message sent successfully to fd=%d", fd);
     }
 
@@ -79,17 +86,25 @@ int send_server_message(int fd, ServerMessage *msg) {
         return -1;
     }
 
+    TRACE_BEGIN("serialize");
     uint32_t nl = htonl(plen);
     memcpy(sb, &nl, 4);
     server_message__pack(msg, sb + 4);
+    TRACE_END("serialize");
 
     LOG_DEBUG("Sending message to fd=%d, size=%zu bytes", fd, plen);
-    int result = send_all(fd, sb, 4 + plen);
+    TRACE_BEGIN("send");
+    uint64_t send_start = metrics_phase_begin();
+    int      result     = send_all(fd, sb, 4 + plen);
+    metrics_send_end(send_start);
+    TRACE_END("send");
     free(sb);
 
     if (result < 0) {
         LOG_ERROR("Failed to send message to fd=%d", fd);
     } else {
+        metric_inc(&g_metrics.messages_out);
+        metric_add(&g_metrics.bytes_out, (uint64_t)result);
         LOG_DEBUG("Message sent successfully to fd=%d", fd);
     }
 
@@ -126,9 +141,15 @@ ClientMessage *receive_client_message(int fd) {
         free(buf);
         return NULL;  // 연결 종료 또는 에러
     }
+    metric_add(&g_metrics.bytes_in, 4 + (uint64_t)msg_len);
+
+    // 재생용 캡처는 해석 전의 바이트를 남긴다 (해석에 실패한 프레임도 재현할 수 있게)
+    capture_frame(fd, lenbuf, buf, msg_len);
 
     // 메시지 역직렬화
+    TRACE_BEGIN("deserialize");
     ClientMessage *msg = client_message__unpack(NULL, msg_len, buf);
+    TRACE_END("deserialize");
     free(buf);
 
     if (msg) {
@@ -172,6 +193,7 @@ ServerMessage *receive_server_message(int fd) {
         free(buf);
         return NULL;  // 연결 종료 또는 에러
     }
+    metric_add(&g_metrics.bytes_in, 4 + (uint64_t)msg_len);
 
     // 메시지 역직렬화
     ServerMessage *msg = server_message__unpack(NULL, msg_len, buf);
@@ -1,30 +1,35 @@
 #ifndef PIECE_H
 #define PIECE_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "types.h"
 
-#define MAX_OFFSETS 8
-
-// 체스 기물 구조체
-typedef struct piece {
-    char        *name;                  // 기물 이름 정의
-    piece_type_t type;                  // 기물 종류 정의
-    offset_t     offsets[MAX_OFFSETS];  // 행마 가능 위치 정의
-    int          offset_len;            // 행마 가능 위치 배열의 길이
-} piece_t;
-
-// 체스 기물 상태 구조체
-typedef struct {
-    piece_t *piece;      // 기물 포인터 (NULL이면 빈 칸)
-    team_t   team;       // TEAM_WHITE(0) or TEAM_BLACK(1)
-    bool     is_dead;    // 기물이 죽었는지 여부
-    bool     has_moved;  // 기물이 이동했는지 여부 (캐슬링, 앙파상 등에 사용)
-} piecestate_t;
-
-// 전역 기물 테이블 (piece.c 에 정의)
-extern piece_t *piece_table[2][6];
-
-// 프로모션 시 기본 퀸 반환 (piece.c 에 정의)
-piece_t *get_default_queen(team_t team);
+// 체스 기물 상태 (칸 하나 = 1바이트, 보드 전체 64바이트)
+//   bit 0-2 : 기물 종류 + 1 (0이면 빈 칸)
+//   bit 3   : 팀 (TEAM_WHITE=0, TEAM_BLACK=1)
+// 캐슬링 권리, 앙파상 칸 등 이동 이력은 game_t가 관리한다
+typedef uint8_t piecestate_t;
+
+#define EMPTY_SQUARE ((piecestate_t)0)
+
+static inline piecestate_t piece_make(team_t team, piece_type_t type) {
+    return (piecestate_t)((type + 1) | (team << 3));
+}
+
+static inline bool piece_is_empty(piecestate_t p) { return p == EMPTY_SQUARE; }
+
+// 빈 칸이 아닐 때만 의미 있음
+static inline piece_type_t piece_type(piecestate_t p) { return (piece_type_t)((p & 7) - 1); }
+static inline team_t       piece_team(piecestate_t p) { return (team_t)(p >> 3); }
+
+static inline bool piece_is(piecestate_t p, team_t team, piece_type_t type) {
+    return p == piece_make(team, type);
+}
+
+static inline bool piece_is_team(piecestate_t p, team_t team) {
+    return !piece_is_empty(p) && piece_team(p) == team;
+}
 
 #endif  // PIECE_H
@@ -3,320 +3,586 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 
+#include "attack_tables.h"
+#include "utils.h"
+
 // 보드 범위 체크
 static inline bool in_board(int x, int y) {
     return x >= 0 && x < 8 && y >= 0 && y < 8;
 }
 
-// (x,y) 칸이 by_team 편에게 공격당하는지
-static bool is_square_attacked(const game_t *G, int x, int y, team_t by_team) {
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            const piecestate_t *ps = &G->board[j][i];
-            // NULL 포인터 검사 추가 - ps->piece가 NULL일 수 있음
-            if (ps->is_dead || ps->piece == NULL || ps->team != by_team)
-                continue;
+// Zobrist 키는 attack_tables.h 에 빌드 시 생성된다
+static inline uint64_t piece_key(team_t team, piece_type_t type, int sq) {
+    return zobrist_pieces[team * 6 + type][sq];
+}
 
-            switch (ps->piece->type) {
-                case PIECE_PAWN: {
-                    int dir = (by_team == TEAM_WHITE ? +1 : -1);
-                    if (j + dir == y && (i - 1 == x || i + 1 == x))
-                        return true;
-                    break;
-                }
-                case PIECE_KNIGHT:
-                case PIECE_KING: {
-                    for (int k = 0; k < ps->piece->offset_len; k++) {
-                        offset_t o = ps->piece->offsets[k];
-                        if (i + o.x == x && j + o.y == y)
-                            return true;
-                    }
-                    break;
-                }
-                case PIECE_BISHOP:
-                case PIECE_ROOK:
-                case PIECE_QUEEN: {
-                    for (int k = 0; k < ps->piece->offset_len; k++) {
-                        offset_t o  = ps->piece->offsets[k];
-                        int      nx = i + o.x, ny = j + o.y;
-                        while (in_board(nx, ny)) {
-                            if (nx == x && ny == y)
-                                return true;
-                            if (!G->board[ny][nx].is_dead)
-                                break;
-                            nx += o.x;
-                            ny += o.y;
-                        }
-                    }
-                    break;
-                }
-            }
+// 차례/캐슬링/앙파상 부분 키 (apply_move 전후로 한 번씩 XOR)
+static inline uint64_t state_key(const game_t *G) {
+    uint64_t h = 0;
+    if (G->side_to_move == TEAM_BLACK)
+        h ^= zobrist_misc[ZOBRIST_SIDE];
+    if (G->white_can_castle_kingside)
+        h ^= zobrist_misc[ZOBRIST_CASTLING + 0];
+    if (G->white_can_castle_queenside)
+        h ^= zobrist_misc[ZOBRIST_CASTLING + 1];
+    if (G->black_can_castle_kingside)
+        h ^= zobrist_misc[ZOBRIST_CASTLING + 2];
+    if (G->black_can_castle_queenside)
+        h ^= zobrist_misc[ZOBRIST_CASTLING + 3];
+    if (in_board(G->en_passant_x, G->en_passant_y))
+        h ^= zobrist_misc[ZOBRIST_EP_FILE + G->en_passant_x];
+    return h;
+}
+
+// bb의 칸이 모두 비어 있는지 (슬라이더 사이 칸 차단 검사)
+static inline bool path_clear(const game_t *G, uint64_t bb) {
+    for (; bb; bb &= bb - 1) {
+        int sq = __builtin_ctzll(bb);
+        if (!piece_is_empty(G->board[SQUARE_Y(sq)][SQUARE_X(sq)]))
+            return false;
+    }
+    return true;
+}
+
+// 슬라이더(비숍/룩/퀸)가 from에서 to까지 막힘 없이 닿는지
+static inline bool slider_reaches(const game_t *G, piece_type_t type, int from, int to) {
+    if (!line_bb[from][to])
+        return false;
+    bool ortho = SQUARE_X(from) == SQUARE_X(to) || SQUARE_Y(from) == SQUARE_Y(to);
+    if ((type == PIECE_BISHOP && ortho) || (type == PIECE_ROOK && !ortho))
+        return false;
+    return path_clear(G, between_bb[from][to]);
+}
+
+// 팀을 상수 인자로 받는 함수는 호출 지점마다 인라인되어 흑/백 전용 코드로 특수화된다
+#define RULE_SPECIALIZE static inline __attribute__((always_inline))
+
+// 칸 번호로 보드 칸 접근
+static inline piecestate_t square_at(const game_t *G, int sq) {
+    return G->board[SQUARE_Y(sq)][SQUARE_X(sq)];
+}
+
+// sq에 team 편 type 기물이 있는지
+static inline bool holds(const game_t *G, int sq, team_t team, piece_type_t type) {
+    return piece_is(square_at(G, sq), team, type);
+}
+
+// 슬라이더 방향 (0-3: 직선, 4-7: 대각선)
+static const int ray_dx[8] = {1, -1, 0, 0, 1, 1, -1, -1};
+static const int ray_dy[8] = {0, 0, 1, -1, 1, -1, 1, -1};
+
+// target이 by 편에게 공격당하는지
+// 보드 전체를 훑지 않고 target에서 거꾸로 공격 가능한 칸만 확인한다
+RULE_SPECIALIZE bool attacked_by(const game_t *G, int target, const team_t by) {
+    // 폰: target을 공격하는 폰 위치 = 반대 편 폰이 target에서 공격하는 칸
+    for (uint64_t b = pawn_attacks[1 - by][target]; b; b &= b - 1)
+        if (holds(G, __builtin_ctzll(b), by, PIECE_PAWN))
+            return true;
+    for (uint64_t b = knight_attacks[target]; b; b &= b - 1)
+        if (holds(G, __builtin_ctzll(b), by, PIECE_KNIGHT))
+            return true;
+    for (uint64_t b = king_attacks[target]; b; b &= b - 1)
+        if (holds(G, __builtin_ctzll(b), by, PIECE_KING))
+            return true;
+
+    // 슬라이더: 각 방향으로 처음 만나는 기물만 확인
+    int tx = SQUARE_X(target), ty = SQUARE_Y(target);
+    for (int d = 0; d < 8; d++) {
+        piece_type_t slider = (d < 4) ? PIECE_ROOK : PIECE_BISHOP;
+        for (int x = tx + ray_dx[d], y = ty + ray_dy[d]; in_board(x, y); x += ray_dx[d], y += ray_dy[d]) {
+            piecestate_t p = G->board[y][x];
+            if (piece_is_empty(p))
+                continue;
+            if (p == piece_make(by, slider) || p == piece_make(by, PIECE_QUEEN))
+                return true;
+            break;
         }
     }
     return false;
 }
 
-// 이동 규칙 검사
-bool is_move_legal(const game_t *G, int sx, int sy, int dx, int dy) {
-    if (!in_board(sx, sy) || !in_board(dx, dy))
+static bool attacked_by_white(const game_t *G, int target) {
+    return attacked_by(G, target, TEAM_WHITE);
+}
+
+static bool attacked_by_black(const game_t *G, int target) {
+    return attacked_by(G, target, TEAM_BLACK);
+}
+
+// (x,y) 칸이 by_team 편에게 공격당하는지
+static bool is_square_attacked(const game_t *G, int x, int y, team_t by_team) {
+    return by_team == TEAM_WHITE ? attacked_by_white(G, SQUARE(x, y)) : attacked_by_black(G, SQUARE(x, y));
+}
+
+// team 킹의 칸 (없으면 -1)
+static int find_king(const game_t *G, team_t team) {
+    for (int sq = 0; sq < 64; sq++)
+        if (holds(G, sq, team, PIECE_KING))
+            return sq;
+    return -1;
+}
+
+// 기물 행마만 검사 (자기 장군 여부는 보지 않음)
+static bool is_pseudo_legal(const game_t *G, move_t m) {
+    int sx = move_from_x(m), sy = move_from_y(m);
+    int dx = move_to_x(m), dy = move_to_y(m);
+    if (sx == dx && sy == dy)
         return false;
-    const piecestate_t *src = &G->board[sy][sx];
-    const piecestate_t *dst = &G->board[dy][dx];
-    // NULL 포인터 검사 추가
-    if (src->is_dead || src->piece == NULL || src->team != G->side_to_move)
+    piecestate_t src = G->board[sy][sx];
+    piecestate_t dst = G->board[dy][dx];
+    if (!piece_is_team(src, G->side_to_move))
         return false;
-    if (!dst->is_dead && dst->piece != NULL && dst->team == G->side_to_move)
+    if (piece_is_team(dst, G->side_to_move))
         return false;
 
-    int  rx = dx - sx, ry = dy - sy;
-    bool ok = false;
+    team_t       team = piece_team(src);
+    piece_type_t type = piece_type(src);
+    int          rx = dx - sx, ry = dy - sy;
+    bool         ok = false;
 
-    switch (src->piece->type) {
+    switch (type) {
         case PIECE_PAWN: {
-            int dir = (src->team == TEAM_WHITE ? +1 : -1);
+            int dir = (team == TEAM_WHITE ? +1 : -1);
             // 한 칸 전진
-            if (rx == 0 && ry == dir && dst->is_dead)
+            if (rx == 0 && ry == dir && piece_is_empty(dst))
                 ok = true;
-            // 두 칸 전진
-            if (rx == 0 && ry == 2 * dir && !src->has_moved && dst->is_dead && G->board[sy + dir][sx].is_dead)
+            // 두 칸 전진 (시작 랭크에 있는 폰만)
+            int start_rank = (team == TEAM_WHITE ? 1 : 6);
+            if (rx == 0 && ry == 2 * dir && sy == start_rank && piece_is_empty(dst) && piece_is_empty(G->board[sy + dir][sx]))
                 ok = true;
             // 대각선 캡처
-            if (abs(rx) == 1 && ry == dir && (!dst->is_dead && dst->team != src->team || (dst->is_dead && G->en_passant_x == dx && G->en_passant_y == dy)))
+            if ((pawn_attacks[team][move_from(m)] & SQUARE_BB(move_to(m))) &&
+                (!piece_is_empty(dst) || (G->en_passant_x == dx && G->en_passant_y == dy)))
                 ok = true;
             break;
         }
         case PIECE_KNIGHT:
         case PIECE_KING: {
-            for (int k = 0; k < src->piece->offset_len; k++) {
-                offset_t o = src->piece->offsets[k];
-                if (o.x == rx && o.y == ry) {
-                    // 캐슬링 처리
-                    if (src->piece->type == PIECE_KING && abs(rx) == 2 && ry == 0) {
-                        bool ks  = rx > 0;
-                        bool can = (src->team == TEAM_WHITE)
-                                       ? (ks ? G->white_can_castle_kingside : G->white_can_castle_queenside)
-                                       : (ks ? G->black_can_castle_kingside : G->black_can_castle_queenside);
-                        if (!can)
-                            return false;
-
-                        int step = ks ? +1 : -1;
-                        // 1) 중간 칸 비어있는지
-                        for (int x = sx + step; x != dx; x += step)
-                            if (!G->board[sy][x].is_dead)
-                                return false;
-                        // 2) 지나가는 칸(출발칸, 중간칸, 도착칸) 모두 공격받지 않는지
-                        for (int x = sx; x != dx + step; x += step)
-                            if (is_square_attacked(G, x, sy, 1 - src->team))
-                                return false;
-                    }
-                    ok = true;
-                    break;
-                }
+            // 캐슬링 처리 (킹 공격 테이블에는 2칸 이동이 없으므로 따로 검사)
+            if (type == PIECE_KING && abs(rx) == 2 && ry == 0) {
+                bool ks  = rx > 0;
+                bool can = (team == TEAM_WHITE)
+                               ? (ks ? G->white_can_castle_kingside : G->white_can_castle_queenside)
+                               : (ks ? G->black_can_castle_kingside : G->black_can_castle_queenside);
+                int  home_rank = (team == TEAM_WHITE ? 0 : 7);
+                if (!can || sx != 4 || sy != home_rank)
+                    return false;
+
+                int step   = ks ? +1 : -1;
+                int rook_x = ks ? 7 : 0;
+                if (!piece_is(G->board[sy][rook_x], team, PIECE_ROOK))
+                    return false;
+                // 1) 킹과 룩 사이 칸이 모두 비어있는지 (퀸사이드는 b파일 포함)
+                for (int x = sx + step; x != rook_x; x += step)
+                    if (!piece_is_empty(G->board[sy][x]))
+                        return false;
+                // 2) 지나가는 칸(출발칸, 중간칸, 도착칸) 모두 공격받지 않는지
+                for (int x = sx; x != dx + step; x += step)
+                    if (is_square_attacked(G, x, sy, 1 - team))
+                        return false;
+                ok = true;
+                break;
             }
+            const uint64_t *attacks = (type == PIECE_KNIGHT) ? knight_attacks : king_attacks;
+            ok                      = (attacks[move_from(m)] & SQUARE_BB(move_to(m))) != 0;
             break;
         }
         case PIECE_BISHOP:
         case PIECE_ROOK:
-        case PIECE_QUEEN: {
-            for (int k = 0; k < src->piece->offset_len; k++) {
-                offset_t o     = src->piece->offsets[k];
-                int      dd    = o.x ? rx / o.x : ry / o.y;
-                bool     align = (o.x == 0
-                                      ? (rx == 0 && ry / o.y > 0)
-                                      : (o.y == 0
-                                             ? (ry == 0 && rx / o.x > 0)
-                                             : (rx % o.x == 0 && ry % o.y == 0 && dd == ry / o.y && dd > 0)));
-                if (!align)
-                    continue;
-                // 중간 칸 확인
-                bool blocked = false;
-                for (int s = 1; s < dd; s++) {
-                    if (!G->board[sy + o.y * s][sx + o.x * s].is_dead) {
-                        blocked = true;
-                        break;
-                    }
-                }
-                if (!blocked) {
-                    ok = true;
-                    break;
-                }
-            }
+        case PIECE_QUEEN:
+            // 정렬 여부와 사이 칸 차단을 모두 테이블로 판정
+            ok = slider_reaches(G, type, move_from(m), move_to(m));
             break;
-        }
     }
 
-    if (!ok)
+    return ok;
+}
+
+// 이동 규칙 검사
+bool is_move_legal(const game_t *G, move_t m) {
+    if (!is_pseudo_legal(G, m))
         return false;
 
     // 자기 장군 방지
-    game_t tmp = *G;
-    apply_move(&tmp, sx, sy, dx, dy);
-    if (is_in_check(&tmp, src->team))
-        return false;
+    game_t tmp  = *G;
+    tmp.history = NULL;  // 시험 적용은 반복 기록에 남기지 않는다
+    apply_move(&tmp, m);
+    return !is_in_check(&tmp, G->side_to_move);
+}
+
+// 수 목록 일괄 검증 (시작 위치부터)
+// 국면 복사 없이 한 게임 상태 위에서 행마 검사 -> 적용 -> 자기 장군 확인만 반복하고,
+// 불법 수를 만나면 직전 국면까지만 다시 적용해 되돌린다 (감사 대상은 대부분 합법이므로 드문 경로)
+bool validate_game(const move_t *moves, size_t n, validate_result_t *result) {
+    game_t *G = &result->final;
+    init_startpos(G);
+
+    for (size_t ply = 0; ply < n; ply++) {
+        team_t mover = G->side_to_move;
+        if (!is_pseudo_legal(G, moves[ply])) {
+            result->ok          = false;
+            result->illegal_ply = ply;
+            return false;
+        }
+
+        apply_move(G, moves[ply]);
+        if (is_in_check(G, mover)) {
+            init_startpos(G);
+            for (size_t i = 0; i < ply; i++)
+                apply_move(G, moves[i]);
+            result->ok          = false;
+            result->illegal_ply = ply;
+            return false;
+        }
+    }
 
+    result->ok          = true;
+    result->illegal_ply = n;
     return true;
 }
 
 // 이동 적용
-void apply_move(game_t *G, int sx, int sy, int dx, int dy) {
-    piecestate_t *src = &G->board[sy][sx];
-    piecestate_t *dst = &G->board[dy][dx];
-
-    // NULL 포인터 검사 추가
-    if (src->piece == NULL) {
-        return;  // 소스 기물이 NULL이면 이동할 수 없음
+void apply_move(game_t *G, move_t m) {
+    int          sx = move_from_x(m), sy = move_from_y(m);
+    int          dx = move_to_x(m), dy = move_to_y(m);
+    int          from = move_from(m), to = move_to(m);
+    piecestate_t src = G->board[sy][sx];
+    piecestate_t dst = G->board[dy][dx];
+
+    // 빈 칸에서는 이동할 수 없음
+    if (piece_is_empty(src)) {
+        return;
     }
 
+    team_t       team = piece_team(src);
+    piece_type_t type = piece_type(src);
+
+    // 해시 증분 갱신: 이전 상태 키와 출발 칸 기물을 빼고 시작
+    uint64_t h = G->hash ^ state_key(G) ^ piece_key(team, type, from);
+
     // 50수 규칙 반영
-    if (src->piece->type == PIECE_PAWN || !dst->is_dead)
+    if (type == PIECE_PAWN || !piece_is_empty(dst))
         G->halfmove_clock = 0;
     else
         G->halfmove_clock++;
 
+    // 일반 캡처
+    if (!piece_is_empty(dst)) {
+        h ^= piece_key(piece_team(dst), piece_type(dst), to);
+        G->piece_count[piece_team(dst)][piece_type(dst)]--;
+    }
+
     // 앙파상 캡처
-    if (src->piece->type == PIECE_PAWN && dx == G->en_passant_x && dy == G->en_passant_y) {
-        piecestate_t *cap = &G->board[sy][dx];
-        cap->is_dead      = 1;
-        cap->piece        = NULL;
+    if (type == PIECE_PAWN && dx == G->en_passant_x && dy == G->en_passant_y) {
+        piecestate_t cap = G->board[sy][dx];
+        if (!piece_is_empty(cap)) {
+            h ^= piece_key(piece_team(cap), piece_type(cap), SQUARE(dx, sy));
+            G->piece_count[piece_team(cap)][piece_type(cap)]--;
+        }
+        G->board[sy][dx] = EMPTY_SQUARE;
+    }
+
+    // 프로모션 (플래그가 없으면 퀸으로 승격)
+    piece_type_t placed = type;
+    if (type == PIECE_PAWN && (dy == 7 || dy == 0)) {
+        placed = (move_flag(m) == MOVE_FLAG_PROMOTION) ? move_promotion(m) : PIECE_QUEEN;
+        G->piece_count[team][PIECE_PAWN]--;
+        G->piece_count[team][placed]++;
     }
 
     // 이동
-    *dst         = *src;
-    src->is_dead = 1;
-    src->piece   = NULL;
+    G->board[dy][dx] = piece_make(team, placed);
+    G->board[sy][sx] = EMPTY_SQUARE;
 
     // 캐슬링 룩 이동
-    if (dst->piece != NULL && dst->piece->type == PIECE_KING && abs(dx - sx) == 2) {
-        bool         ks                   = dx > sx;
-        int          rook_from_x          = ks ? 7 : 0;
-        int          rook_to_x            = ks ? dx - 1 : dx + 1;
-        piecestate_t rook                 = G->board[dy][rook_from_x];
-        G->board[dy][rook_to_x]           = rook;
-        G->board[dy][rook_from_x].is_dead = 1;
-        G->board[dy][rook_from_x].piece   = NULL;
+    if (type == PIECE_KING && abs(dx - sx) == 2) {
+        bool ks          = dx > sx;
+        int  rook_from_x = ks ? 7 : 0;
+        int  rook_to_x   = ks ? dx - 1 : dx + 1;
+        G->board[dy][rook_to_x]   = G->board[dy][rook_from_x];
+        G->board[dy][rook_from_x] = EMPTY_SQUARE;
+        h ^= piece_key(team, PIECE_ROOK, SQUARE(rook_from_x, dy)) ^ piece_key(team, PIECE_ROOK, SQUARE(rook_to_x, dy));
     }
 
-    // 캐슬링 권리 소멸
-    if (dst->piece != NULL && dst->piece->type == PIECE_KING) {
-        if (dst->team == TEAM_WHITE)
+    // 캐슬링 권리 소멸: 킹이 움직이거나, 코너 칸에서 기물이 떠나거나 잡힐 때
+    if (type == PIECE_KING) {
+        if (team == TEAM_WHITE)
             G->white_can_castle_kingside = G->white_can_castle_queenside = false;
         else
             G->black_can_castle_kingside = G->black_can_castle_queenside = false;
     }
-    if (dst->piece != NULL && dst->piece->type == PIECE_ROOK && !dst->has_moved) {
-        if (dst->team == TEAM_WHITE) {
-            if (sx == 0 && sy == 0)
-                G->white_can_castle_queenside = false;
-            if (sx == 7 && sy == 0)
-                G->white_can_castle_kingside = false;
-        } else {
-            if (sx == 0 && sy == 7)
-                G->black_can_castle_queenside = false;
-            if (sx == 7 && sy == 7)
-                G->black_can_castle_kingside = false;
-        }
-    }
+    if (from == SQUARE(0, 0) || to == SQUARE(0, 0))
+        G->white_can_castle_queenside = false;
+    if (from == SQUARE(7, 0) || to == SQUARE(7, 0))
+        G->white_can_castle_kingside = false;
+    if (from == SQUARE(0, 7) || to == SQUARE(0, 7))
+        G->black_can_castle_queenside = false;
+    if (from == SQUARE(7, 7) || to == SQUARE(7, 7))
+        G->black_can_castle_kingside = false;
 
     // 앙파상 타겟 갱신
-    if (dst->piece != NULL && dst->piece->type == PIECE_PAWN && abs(dy - sy) == 2) {
+    if (type == PIECE_PAWN && abs(dy - sy) == 2) {
         G->en_passant_x = dx;
         G->en_passant_y = (sy + dy) / 2;
     } else {
         G->en_passant_x = G->en_passant_y = -1;
     }
 
-    // 프로모션 (기본 퀸으로 자동 승격)
-    if (dst->piece != NULL && dst->piece->type == PIECE_PAWN && (dy == 7 || dy == 0)) {
-        // extern으로 정의된 queen_piecestate를 가리키도록 하거나
-        // 별도의 get_promotion_piece(team) 함수를 호출하세요.
-        dst->piece = get_default_queen(dst->team);
-    }
-
-    dst->has_moved  = true;
+    // 흑이 둔 뒤 풀수 증가
+    if (G->side_to_move == TEAM_BLACK)
+        G->fullmove_number++;
     G->side_to_move = (G->side_to_move == TEAM_WHITE) ? TEAM_BLACK : TEAM_WHITE;
-}
 
-// 체크 상태 확인
-bool is_in_check(const game_t *G, team_t team) {
-    // 킹의 위치 찾기
-    int king_x = -1, king_y = -1;
-    for (int x = 0; x < 8; x++) {
-        for (int y = 0; y < 8; y++) {
-            const piecestate_t *ps = &G->board[y][x];
-            // NULL 포인터 검사 추가 - ps->piece가 NULL일 수 있음
-            if (!ps->is_dead && ps->piece != NULL && ps->team == team && ps->piece->type == PIECE_KING) {
-                king_x = x;
-                king_y = y;
-                break;
-            }
-        }
-        if (king_x != -1) break;
+    // 도착 칸 기물(프로모션 반영)과 새 상태 키를 더해 해시 완성
+    G->hash = h ^ piece_key(team, placed, to) ^ state_key(G);
+
+    // 반복 판정용 기록 (폰 이동/캡처 이후의 국면만 비교 대상)
+    if (G->history != NULL) {
+        position_history_t *hist = G->history;
+        if (G->halfmove_clock == 0 || hist->count >= POSITION_HISTORY_MAX)
+            hist->count = 0;
+        hist->hashes[hist->count++] = G->hash;
     }
+}
 
-    if (king_x == -1) return false;  // 킹이 없으면 체크가 아님
+// 시험 적용 후 자기 킹이 공격받지 않는지 (king_sq는 이동 전 킹 칸, 킹이 없으면 -1)
+RULE_SPECIALIZE bool king_safe_after(const game_t *G, move_t m, int king_sq, const team_t us) {
+    game_t tmp  = *G;
+    tmp.history = NULL;  // 시험 적용은 반복 기록에 남기지 않는다
+    apply_move(&tmp, m);
+    int k = (move_from(m) == king_sq) ? move_to(m) : king_sq;
+    return k < 0 || !attacked_by(&tmp, k, 1 - us);
+}
 
-    return is_square_attacked(G, king_x, king_y, (team == TEAM_WHITE) ? TEAM_BLACK : TEAM_WHITE);
+RULE_SPECIALIZE int push_safe(const game_t *G, move_t m, int king_sq, const team_t us, move_t *moves, int n) {
+    if (king_safe_after(G, m, king_sq, us))
+        moves[n++] = m;
+    return n;
 }
 
-// 체크메이트 확인
-bool is_checkmate(const game_t *G) {
-    team_t team = G->side_to_move;
+// 폰 전진/캡처 (마지막 랭크에 도달하면 네 가지 프로모션을 각각 추가)
+RULE_SPECIALIZE int push_pawn(const game_t *G, int from, int to, int king_sq, const team_t us, move_t *moves, int n) {
+    const int promo_rank = (us == TEAM_WHITE) ? 7 : 0;
+    if (SQUARE_Y(to) != promo_rank)
+        return push_safe(G, move_make_sq(from, to, MOVE_FLAG_NORMAL, PIECE_PAWN), king_sq, us, moves, n);
+
+    // 승격 기물은 자기 장군 여부에 영향이 없으므로 한 번만 검사
+    if (!king_safe_after(G, move_make_sq(from, to, MOVE_FLAG_PROMOTION, PIECE_QUEEN), king_sq, us))
+        return n;
+    for (piece_type_t t = PIECE_KNIGHT; t <= PIECE_QUEEN; t++)
+        moves[n++] = move_make_sq(from, to, MOVE_FLAG_PROMOTION, t);
+    return n;
+}
 
-    // 체크 상태가 아니면 체크메이트가 아님
-    if (!is_in_check(G, team)) {
-        return false;
+RULE_SPECIALIZE int gen_pawn(const game_t *G, int from, int king_sq, const team_t us, move_t *moves, int n) {
+    const int step       = (us == TEAM_WHITE) ? 8 : -8;
+    const int start_rank = (us == TEAM_WHITE) ? 1 : 6;
+    const int last_rank  = (us == TEAM_WHITE) ? 7 : 0;
+    if (SQUARE_Y(from) == last_rank)  // FEN으로 놓인 비정상 폰
+        return n;
+
+    // 전진
+    int to = from + step;
+    if (piece_is_empty(square_at(G, to))) {
+        n = push_pawn(G, from, to, king_sq, us, moves, n);
+        if (SQUARE_Y(from) == start_rank && piece_is_empty(square_at(G, to + step)))
+            n = push_safe(G, move_make_sq(from, to + step, MOVE_FLAG_NORMAL, PIECE_PAWN), king_sq, us, moves, n);
     }
 
-    // 모든 가능한 수를 시도해서 체크에서 벗어날 수 있는지 확인
-    for (int sx = 0; sx < 8; sx++) {
-        for (int sy = 0; sy < 8; sy++) {
-            const piecestate_t *src = &G->board[sy][sx];
-            if (src->is_dead || src->piece == NULL || src->team != team) continue;
-
-            for (int dx = 0; dx < 8; dx++) {
-                for (int dy = 0; dy < 8; dy++) {
-                    if (is_move_legal(G, sx, sy, dx, dy)) {
-                        return false;  // 합법적인 수가 있으면 체크메이트가 아님
-                    }
-                }
-            }
-        }
+    // 캡처 / 앙파상
+    for (uint64_t b = pawn_attacks[us][from]; b; b &= b - 1) {
+        int          cap = __builtin_ctzll(b);
+        piecestate_t p   = square_at(G, cap);
+        if (piece_is_team(p, 1 - us))
+            n = push_pawn(G, from, cap, king_sq, us, moves, n);
+        else if (piece_is_empty(p) && SQUARE_X(cap) == G->en_passant_x && SQUARE_Y(cap) == G->en_passant_y)
+            n = push_safe(G, move_make_sq(from, cap, MOVE_FLAG_EN_PASSANT, PIECE_PAWN), king_sq, us, moves, n);
     }
+    return n;
+}
 
-    return true;  // 합법적인 수가 없으면 체크메이트
+// 나이트/킹: 공격 테이블의 칸 중 자기 기물이 없는 칸
+RULE_SPECIALIZE int gen_leaper(const game_t *G, int from, uint64_t targets, int king_sq, const team_t us,
+                               move_t *moves, int n) {
+    for (; targets; targets &= targets - 1) {
+        int to = __builtin_ctzll(targets);
+        if (piece_is_team(square_at(G, to), us))
+            continue;
+        n = push_safe(G, move_make_sq(from, to, MOVE_FLAG_NORMAL, PIECE_PAWN), king_sq, us, moves, n);
+    }
+    return n;
 }
 
-// 스테일메이트 확인
-bool is_stalemate(const game_t *G) {
-    team_t team = G->side_to_move;
+// 슬라이더: ray_dx/ray_dy의 [d_begin, d_end) 방향으로 막힐 때까지
+RULE_SPECIALIZE int gen_slider(const game_t *G, int from, int d_begin, int d_end, int king_sq, const team_t us,
+                               move_t *moves, int n) {
+    int fx = SQUARE_X(from), fy = SQUARE_Y(from);
+    for (int d = d_begin; d < d_end; d++) {
+        for (int x = fx + ray_dx[d], y = fy + ray_dy[d]; in_board(x, y); x += ray_dx[d], y += ray_dy[d]) {
+            piecestate_t p = G->board[y][x];
+            if (piece_is_team(p, us))
+                break;
+            n = push_safe(G, move_make_sq(from, SQUARE(x, y), MOVE_FLAG_NORMAL, PIECE_PAWN), king_sq, us, moves, n);
+            if (!piece_is_empty(p))
+                break;
+        }
+    }
+    return n;
+}
 
-    // 체크 상태이면 스테일메이트가 아님
-    if (is_in_check(G, team)) {
-        return false;
+RULE_SPECIALIZE int gen_king(const game_t *G, int from, const team_t us, move_t *moves, int n) {
+    n = gen_leaper(G, from, king_attacks[from], from, us, moves, n);
+
+    // 캐슬링 후보 (권리, 룩, 빈 칸, 공격받는 칸 검사는 is_pseudo_legal이 담당)
+    bool ks = (us == TEAM_WHITE) ? G->white_can_castle_kingside : G->black_can_castle_kingside;
+    bool qs = (us == TEAM_WHITE) ? G->white_can_castle_queenside : G->black_can_castle_queenside;
+    if (SQUARE_X(from) != 4)
+        return n;
+    if (ks) {
+        move_t m = move_make_sq(from, from + 2, MOVE_FLAG_CASTLING, PIECE_PAWN);
+        if (is_pseudo_legal(G, m))
+            moves[n++] = m;
+    }
+    if (qs) {
+        move_t m = move_make_sq(from, from - 2, MOVE_FLAG_CASTLING, PIECE_PAWN);
+        if (is_pseudo_legal(G, m))
+            moves[n++] = m;
     }
+    return n;
+}
 
-    // 모든 가능한 수를 시도해서 합법적인 수가 있는지 확인
-    for (int sx = 0; sx < 8; sx++) {
-        for (int sy = 0; sy < 8; sy++) {
-            const piecestate_t *src = &G->board[sy][sx];
-            if (src->is_dead || src->piece == NULL || src->team != team) continue;
-
-            for (int dx = 0; dx < 8; dx++) {
-                for (int dy = 0; dy < 8; dy++) {
-                    if (is_move_legal(G, sx, sy, dx, dy)) {
-                        return false;  // 합법적인 수가 있으면 스테일메이트가 아님
-                    }
-                }
-            }
+// 한 편의 합법 수 생성 (us는 호출 지점에서 상수)
+// 기물 종류별 생성기로 나누고, 후보마다 시험 적용 후 자기 킹 안전만 확인한다
+RULE_SPECIALIZE int generate_side(const game_t *G, move_t *moves, const team_t us) {
+    int king_sq = find_king(G, us);
+    int n       = 0;
+
+    for (int from = 0; from < 64; from++) {
+        piecestate_t p = square_at(G, from);
+        if (!piece_is_team(p, us))
+            continue;
+
+        switch (piece_type(p)) {
+            case PIECE_PAWN:
+                n = gen_pawn(G, from, king_sq, us, moves, n);
+                break;
+            case PIECE_KNIGHT:
+                n = gen_leaper(G, from, knight_attacks[from], king_sq, us, moves, n);
+                break;
+            case PIECE_BISHOP:
+                n = gen_slider(G, from, 4, 8, king_sq, us, moves, n);
+                break;
+            case PIECE_ROOK:
+                n = gen_slider(G, from, 0, 4, king_sq, us, moves, n);
+                break;
+            case PIECE_QUEEN:
+                n = gen_slider(G, from, 0, 8, king_sq, us, moves, n);
+                break;
+            case PIECE_KING:
+                n = gen_king(G, from, us, moves, n);
+                break;
         }
     }
+    return n;
+}
 
-    return true;  // 합법적인 수가 없으면 스테일메이트
+static int generate_white(const game_t *G, move_t *moves) {
+    return generate_side(G, moves, TEAM_WHITE);
+}
+
+static int generate_black(const game_t *G, move_t *moves) {
+    return generate_side(G, moves, TEAM_BLACK);
+}
+
+// 합법 수 생성
+int generate_legal_moves(const game_t *G, move_t *moves) {
+    return G->side_to_move == TEAM_WHITE ? generate_white(G, moves) : generate_black(G, moves);
+}
+
+// 체크 상태 확인
+bool is_in_check(const game_t *G, team_t team) {
+    int king_sq = find_king(G, team);
+    if (king_sq < 0) return false;  // 킹이 없으면 체크가 아님
+
+    return team == TEAM_WHITE ? attacked_by_black(G, king_sq) : attacked_by_white(G, king_sq);
+}
+
+// 체크메이트 확인 (체크 상태이고 합법 수가 없음)
+bool is_checkmate(const game_t *G) {
+    move_t moves[MAX_LEGAL_MOVES];
+    return is_in_check(G, G->side_to_move) && generate_legal_moves(G, moves) == 0;
+}
+
+// 스테일메이트 확인 (체크가 아니고 합법 수가 없음)
+bool is_stalemate(const game_t *G) {
+    move_t moves[MAX_LEGAL_MOVES];
+    return !is_in_check(G, G->side_to_move) && generate_legal_moves(G, moves) == 0;
 }
 
 // 50수 규칙 확인
 bool is_fifty_move_rule(const game_t *G) {
     return G->halfmove_clock >= 100;  // 50수 = 100 half-moves
 }
+
+// 국면 해시 계산 (처음부터 다시 계산, apply_move는 G->hash를 증분 갱신)
+uint64_t position_hash(const game_t *G) {
+    uint64_t h = state_key(G);
+
+    for (int sq = 0; sq < 64; sq++) {
+        piecestate_t p = square_at(G, sq);
+        if (piece_is_empty(p))
+            continue;
+        h ^= piece_key(piece_team(p), piece_type(p), sq);
+    }
+    return h;
+}
+
+// 반복 기록 연결 (현재 국면을 첫 기록으로 둔다)
+void position_history_attach(game_t *G, position_history_t *hist) {
+    G->history      = hist;
+    hist->count     = 1;
+    hist->hashes[0] = G->hash;
+}
+
+// 3회 동형 반복
+// 해시에 차례가 포함되므로 같은 편 차례였던 국면(2 half-move 간격)만 비교
+bool is_threefold_repetition(const game_t *G) {
+    const position_history_t *hist = G->history;
+    if (hist == NULL || hist->count < 5)
+        return false;
+
+    int reps = 1;
+    for (int i = hist->count - 3; i >= 0; i -= 2) {
+        if (hist->hashes[i] == G->hash && ++reps >= 3)
+            return true;
+    }
+    return false;
+}
+
+// 기물 부족 (어느 쪽도 체크메이트를 만들 수 없는 경우)
+//   킹 vs 킹, 킹+마이너 1개 vs 킹, 비숍만 남았고 모두 같은 색 칸에 있는 경우
+bool is_insufficient_material(const game_t *G) {
+    const uint8_t(*cnt)[6] = G->piece_count;
+    for (int t = 0; t < 2; t++)
+        if (cnt[t][PIECE_PAWN] || cnt[t][PIECE_ROOK] || cnt[t][PIECE_QUEEN])
+            return false;
+
+    int knights = cnt[TEAM_WHITE][PIECE_KNIGHT] + cnt[TEAM_BLACK][PIECE_KNIGHT];
+    int bishops = cnt[TEAM_WHITE][PIECE_BISHOP] + cnt[TEAM_BLACK][PIECE_BISHOP];
+    if (knights + bishops <= 1)
+        return true;
+    if (knights > 0)
+        return false;
+
+    // 비숍만 여러 개: 드문 경우이므로 여기서만 보드를 훑어 칸 색을 확인
+    int colors = 0;
+    for (int sq = 0; sq < 64; sq++) {
+        piecestate_t p = square_at(G, sq);
+        if (!piece_is_empty(p) && piece_type(p) == PIECE_BISHOP)
+            colors |= 1 << ((SQUARE_X(sq) + SQUARE_Y(sq)) & 1);
+    }
+    return colors != 3;
+}
@@ -3,16 +3,28 @@
 #define RULE_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
+#include "move.h"
 #include "piece.h"
 #include "types.h"
 
+// 반복 판정용 국면 기록 (마지막 폰 이동/캡처 이후)
+// 50수 규칙으로 100 half-move 안에 게임이 끝나므로 이 크기면 충분하다
+#define POSITION_HISTORY_MAX 128
+typedef struct {
+    uint64_t hashes[POSITION_HISTORY_MAX];
+    int      count;
+} position_history_t;
+
 // 통합 게임 상태 구조체 (클라이언트와 서버 공통 사용)
 typedef struct {
     piecestate_t board[BOARD_SIZE][BOARD_SIZE];
 
-    team_t side_to_move;    // TEAM_WHITE 또는 TEAM_BLACK
-    int    halfmove_clock;  // 50수 규칙 카운트(폰 이동·캡처 후 0으로)
+    team_t side_to_move;     // TEAM_WHITE 또는 TEAM_BLACK
+    int    halfmove_clock;   // 50수 규칙 카운트(폰 이동·캡처 후 0으로)
+    int    fullmove_number;  // 풀수 번호 (1부터, 흑이 둘 때마다 증가)
 
     // 캐슬링 권리
     bool white_can_castle_kingside;
@@ -23,16 +35,40 @@ typedef struct {
     // 앙파상 대상 칸 (없으면 -1,-1)
     int en_passant_x, en_passant_y;
 
+    // 국면 해시와 기물 수 (fen_parse가 초기화, apply_move가 증분 갱신)
+    uint64_t hash;
+    uint8_t  piece_count[2][6];  // [team][piece_type]
+
+    // 반복 판정용 기록 (NULL이면 기록하지 않음, position_history_attach로 연결)
+    // game_t를 복사해도 기록은 공유되므로 시험 적용 시에는 NULL로 둔다
+    position_history_t* history;
+
     // 게임 상태 (클라이언트에서 사용)
     bool is_check;
     bool is_checkmate;
     bool is_stalemate;
-    int  fullmove_number;
 } game_t;
 
-// 이동 규칙 검사/적용
-bool is_move_legal(const game_t* G, int sx, int sy, int dx, int dy);
-void apply_move(game_t* G, int sx, int sy, int dx, int dy);
+// 한 국면에서 나올 수 있는 최대 합법 수 (알려진 최대치 218)
+#define MAX_LEGAL_MOVES 256
+
+// 이동 규칙 검사/적용 (좌표는 move_make(file, rank, file, rank)로 만든다)
+bool is_move_legal(const game_t* G, move_t m);
+void apply_move(game_t* G, move_t m);
+
+// side_to_move의 합법 수를 moves에 채우고 개수를 반환 (moves는 MAX_LEGAL_MOVES 이상)
+int generate_legal_moves(const game_t* G, move_t* moves);
+
+// validate_game 결과
+typedef struct {
+    bool   ok;           // 모든 수가 합법이면 true
+    size_t illegal_ply;  // 첫 불법 수의 인덱스 (ok이면 n)
+    game_t final;        // 마지막 합법 수까지 적용한 국면
+} validate_result_t;
+
+// 시작 위치부터 moves[0..n)을 차례로 검증하며 적용 (저장된 게임 일괄 감사용)
+// 모두 합법이면 true, 아니면 첫 불법 수 직전 국면과 함께 false
+bool validate_game(const move_t* moves, size_t n, validate_result_t* result);
 
 // 체크, 종료 조건
 bool is_in_check(const game_t* G, team_t team);
@@ -40,4 +76,14 @@ bool is_checkmate(const game_t* G);
 bool is_stalemate(const game_t* G);
 bool is_fifty_move_rule(const game_t* G);
 
+bool is_threefold_repetition(const game_t* G);
+bool is_insufficient_material(const game_t* G);
+
+// 국면 해시 (Zobrist: 기물 배치, 차례, 캐슬링 권리, 앙파상 파일)
+// 처음부터 계산하며, 항상 G->hash와 같아야 한다
+uint64_t position_hash(const game_t* G);
+
+// G에 반복 기록을 연결하고 현재 국면을 첫 기록으로 둔다
+void position_history_attach(game_t* G, position_history_t* hist);
+
 #endif  // RULE_H
@@ -0,0 +1,436 @@
+// search.c
+#include "search.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// 확장 포함 최대 탐색 ply (이보다 깊으면 정적 평가로 끊는다)
+#define SEARCH_MAX_PLY 64
+
+// 시간 검사 간격 (노드 수, 2의 거듭제곱 - 1)
+#define SEARCH_TIME_CHECK_MASK 1023
+
+// 기물 가치 (piece_type_t 순서)
+static const int piece_value[6] = {100, 320, 330, 500, 900, 0};
+
+// 위치 가산점 (백 기준, 8랭크부터 1랭크 순서로 적은 표)
+// 흑 기물은 같은 표를 위아래로 뒤집어 쓴다
+static const int8_t pst[6][64] = {
+    // 폰
+    {0, 0, 0, 0, 0, 0, 0, 0,
+     50, 50, 50, 50, 50, 50, 50, 50,
+     10, 10, 20, 30, 30, 20, 10, 10,
+     5, 5, 10, 25, 25, 10, 5, 5,
+     0, 0, 0, 20, 20, 0, 0, 0,
+     5, -5, -10, 0, 0, -10, -5, 5,
+     5, 10, 10, -20, -20, 10, 10, 5,
+     0, 0, 0, 0, 0, 0, 0, 0},
+    // 나이트
+    {-50, -40, -30, -30, -30, -30, -40, -50,
+     -40, -20, 0, 0, 0, 0, -20, -40,
+     -30, 0, 10, 15, 15, 10, 0, -30,
+     -30, 5, 15, 20, 20, 15, 5, -30,
+     -30, 0, 15, 20, 20, 15, 0, -30,
+     -30, 5, 10, 15, 15, 10, 5, -30,
+     -40, -20, 0, 5, 5, 0, -20, -40,
+     -50, -40, -30, -30, -30, -30, -40, -50},
+    // 비숍
+    {-20, -10, -10, -10, -10, -10, -10, -20,
+     -10, 0, 0, 0, 0, 0, 0, -10,
+     -10, 0, 5, 10, 10, 5, 0, -10,
+     -10, 5, 5, 10, 10, 5, 5, -10,
+     -10, 0, 10, 10, 10, 10, 0, -10,
+     -10, 10, 10, 10, 10, 10, 10, -10,
+     -10, 5, 0, 0, 0, 0, 5, -10,
+     -20, -10, -10, -10, -10, -10, -10, -20},
+    // 룩
+    {0, 0, 0, 0, 0, 0, 0, 0,
+     5, 10, 10, 10, 10, 10, 10, 5,
+     -5, 0, 0, 0, 0, 0, 0, -5,
+     -5, 0, 0, 0, 0, 0, 0, -5,
+     -5, 0, 0, 0, 0, 0, 0, -5,
+     -5, 0, 0, 0, 0, 0, 0, -5,
+     -5, 0, 0, 0, 0, 0, 0, -5,
+     0, 0, 0, 5, 5, 0, 0, 0},
+    // 퀸
+    {-20, -10, -10, -5, -5, -10, -10, -20,
+     -10, 0, 0, 0, 0, 0, 0, -10,
+     -10, 0, 5, 5, 5, 5, 0, -10,
+     -5, 0, 5, 5, 5, 5, 0, -5,
+     0, 0, 5, 5, 5, 5, 0, -5,
+     -10, 5, 5, 5, 5, 5, 0, -10,
+     -10, 0, 5, 0, 0, 0, 0, -10,
+     -20, -10, -10, -5, -5, -10, -10, -20},
+    // 킹 (중반 기준: 캐슬링한 자리 선호)
+    {-30, -40, -40, -50, -50, -40, -40, -30,
+     -30, -40, -40, -50, -50, -40, -40, -30,
+     -30, -40, -40, -50, -50, -40, -40, -30,
+     -30, -40, -40, -50, -50, -40, -40, -30,
+     -20, -30, -30, -40, -40, -30, -30, -20,
+     -10, -20, -20, -20, -20, -20, -20, -10,
+     20, 20, 0, 0, 0, 0, 20, 20,
+     20, 30, 10, 0, 0, 10, 30, 20}};
+
+int evaluate(const game_t *G) {
+    int score = 0;  // 백 기준
+
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            piecestate_t p = G->board[y][x];
+            if (piece_is_empty(p))
+                continue;
+            piece_type_t type = piece_type(p);
+            if (piece_team(p) == TEAM_WHITE)
+                score += piece_value[type] + pst[type][(7 - y) * 8 + x];
+            else
+                score -= piece_value[type] + pst[type][y * 8 + x];
+        }
+    }
+    return G->side_to_move == TEAM_WHITE ? score : -score;
+}
+
+// ===================================================================
+// 치환표
+// ===================================================================
+
+bool tt_init(tt_t *tt, size_t size_mb) {
+    size_t count = 1;
+    while (count * 2 * sizeof(tt_entry_t) <= size_mb * 1024 * 1024)
+        count *= 2;
+
+    tt->entries = calloc(count, sizeof(tt_entry_t));
+    if (!tt->entries) {
+        tt->mask = 0;
+        return false;
+    }
+    tt->mask = count - 1;
+    return true;
+}
+
+void tt_free(tt_t *tt) {
+    free(tt->entries);
+    tt->entries = NULL;
+    tt->mask    = 0;
+}
+
+void tt_clear(tt_t *tt) {
+    if (tt->entries)
+        memset(tt->entries, 0, (tt->mask + 1) * sizeof(tt_entry_t));
+}
+
+// 스레드별 치환표 (처음 쓸 때 할당, 스레드 종료 시 해제)
+static pthread_key_t  tt_key;
+static pthread_once_t tt_key_once = PTHREAD_ONCE_INIT;
+
+static void tt_destroy(void *p) {
+    tt_free(p);
+    free(p);
+}
+
+static void tt_key_create(void) {
+    pthread_key_create(&tt_key, tt_destroy);
+}
+
+tt_t *tt_thread_local(size_t size_mb) {
+    pthread_once(&tt_key_once, tt_key_create);
+    tt_t *tt = pthread_getspecific(tt_key);
+    if (!tt) {
+        tt = malloc(sizeof(tt_t));
+        if (!tt || !tt_init(tt, size_mb)) {
+            free(tt);
+            return NULL;
+        }
+        pthread_setspecific(tt_key, tt);
+    }
+    return tt;
+}
+
+// 메이트 점수는 "루트에서 몇 수"가 아니라 "이 노드에서 몇 수"로 저장해야
+// 다른 경로로 같은 국면에 도달해도 올바른 거리가 나온다
+static inline int score_to_tt(int score, int ply) {
+    if (score >= SCORE_MATE_MIN) return score + ply;
+    if (score <= -SCORE_MATE_MIN) return score - ply;
+    return score;
+}
+
+static inline int score_from_tt(int score, int ply) {
+    if (score >= SCORE_MATE_MIN) return score - ply;
+    if (score <= -SCORE_MATE_MIN) return score + ply;
+    return score;
+}
+
+static inline tt_entry_t *tt_probe(tt_t *tt, uint64_t key) {
+    tt_entry_t *e = &tt->entries[key & tt->mask];
+    return e->key == key ? e : NULL;
+}
+
+// 깊이 우선 교체 (같은 국면이면 항상 갱신)
+static inline void tt_store(tt_t *tt, uint64_t key, move_t move, int score, int depth, int bound, int ply) {
+    tt_entry_t *e = &tt->entries[key & tt->mask];
+    if (e->key != key && e->depth > depth)
+        return;
+    if (move == MOVE_NONE && e->key == key)
+        move = e->move;
+    e->key   = key;
+    e->move  = move;
+    e->score = (int16_t)score_to_tt(score, ply);
+    e->depth = (int8_t)depth;
+    e->bound = (uint8_t)bound;
+}
+
+// ===================================================================
+// 탐색
+// ===================================================================
+
+typedef struct {
+    tt_t    *tt;
+    uint64_t nodes;
+    int64_t  deadline_ms;  // 0이면 시간 제한 없음
+    bool     stopped;
+
+    // 반복 판정용 해시 경로 (게임 기록 + 현재 탐색 경로)
+    uint64_t path[POSITION_HISTORY_MAX + SEARCH_MAX_PLY];
+    int      path_len;
+} search_ctx_t;
+
+static int64_t monotonic_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static inline void check_time(search_ctx_t *ctx) {
+    if (ctx->deadline_ms && (ctx->nodes & SEARCH_TIME_CHECK_MASK) == 0 && monotonic_ms() >= ctx->deadline_ms)
+        ctx->stopped = true;
+}
+
+// 마지막 폰 이동/캡처 이후 같은 편 차례였던 국면 중 같은 해시가 있으면 반복
+static bool is_repetition(const search_ctx_t *ctx, const game_t *G) {
+    int limit = ctx->path_len - 1 - G->halfmove_clock;
+    for (int i = ctx->path_len - 3; i >= 0 && i >= limit; i -= 2)
+        if (ctx->path[i] == G->hash)
+            return true;
+    return false;
+}
+
+static inline bool is_capture(const game_t *G, move_t m) {
+    return !piece_is_empty(G->board[move_to_y(m)][move_to_x(m)]) || move_flag(m) == MOVE_FLAG_EN_PASSANT;
+}
+
+// 수 정렬 점수: 치환표 수 > 캡처(MVV-LVA) / 프로모션 > 조용한 수
+static int move_order_score(const game_t *G, move_t m, move_t tt_move) {
+    if (m == tt_move)
+        return 1000000;
+
+    int          score  = 0;
+    piecestate_t victim = G->board[move_to_y(m)][move_to_x(m)];
+    if (!piece_is_empty(victim)) {
+        piecestate_t attacker = G->board[move_from_y(m)][move_from_x(m)];
+        score += 10000 + piece_value[piece_type(victim)] * 10 - piece_value[piece_type(attacker)] / 10;
+    } else if (move_flag(m) == MOVE_FLAG_EN_PASSANT) {
+        score += 10000 + piece_value[PIECE_PAWN] * 10 - piece_value[PIECE_PAWN] / 10;
+    }
+    if (move_flag(m) == MOVE_FLAG_PROMOTION)
+        score += 9000 + piece_value[move_promotion(m)];
+    return score;
+}
+
+static void order_moves(const game_t *G, move_t *moves, int n, move_t tt_move) {
+    int scores[MAX_LEGAL_MOVES];
+    for (int i = 0; i < n; i++)
+        scores[i] = move_order_score(G, moves[i], tt_move);
+
+    // 삽입 정렬 (수가 많지 않고 대부분 앞쪽 몇 개에서 컷이 난다)
+    for (int i = 1; i < n; i++) {
+        move_t m = moves[i];
+        int    s = scores[i];
+        int    j = i - 1;
+        while (j >= 0 && scores[j] < s) {
+            moves[j + 1]  = moves[j];
+            scores[j + 1] = scores[j];
+            j--;
+        }
+        moves[j + 1]  = m;
+        scores[j + 1] = s;
+    }
+}
+
+// 정지 탐색: 캡처와 프로모션만 따라가 수평선 효과를 줄인다
+static int quiescence(search_ctx_t *ctx, const game_t *G, int alpha, int beta, int ply) {
+    ctx->nodes++;
+    check_time(ctx);
+    if (ctx->stopped)
+        return 0;
+
+    int stand_pat = evaluate(G);
+    if (ply >= SEARCH_MAX_PLY)
+        return stand_pat;
+    if (stand_pat >= beta)
+        return stand_pat;
+    if (stand_pat > alpha)
+        alpha = stand_pat;
+
+    move_t moves[MAX_LEGAL_MOVES];
+    int    n = generate_legal_moves(G, moves);
+    if (n == 0)
+        return is_in_check(G, G->side_to_move) ? -SCORE_MATE + ply : 0;
+
+    // 전술 수만 남긴다
+    int k = 0;
+    for (int i = 0; i < n; i++)
+        if (is_capture(G, moves[i]) || move_flag(moves[i]) == MOVE_FLAG_PROMOTION)
+            moves[k++] = moves[i];
+    order_moves(G, moves, k, MOVE_NONE);
+
+    int best = stand_pat;
+    for (int i = 0; i < k; i++) {
+        game_t child = *G;
+        apply_move(&child, moves[i]);
+        int score = -quiescence(ctx, &child, -beta, -alpha, ply + 1);
+        if (ctx->stopped)
+            return 0;
+        if (score > best) {
+            best = score;
+            if (score > alpha) {
+                alpha = score;
+                if (score >= beta)
+                    break;
+            }
+        }
+    }
+    return best;
+}
+
+static int alpha_beta(search_ctx_t *ctx, const game_t *G, int depth, int alpha, int beta, int ply, move_t *best_out) {
+    ctx->nodes++;
+    check_time(ctx);
+    if (ctx->stopped)
+        return 0;
+
+    // 무승부 규칙 (루트는 제외: 루트에서는 반드시 수를 골라야 한다)
+    if (ply > 0 && (G->halfmove_clock >= 100 || is_repetition(ctx, G) || is_insufficient_material(G)))
+        return 0;
+
+    bool in_check = is_in_check(G, G->side_to_move);
+    if (in_check)
+        depth++;  // 체크 연장
+    if (depth <= 0 || ply >= SEARCH_MAX_PLY)
+        return quiescence(ctx, G, alpha, beta, ply);
+
+    // 치환표 조회
+    move_t      tt_move = MOVE_NONE;
+    tt_entry_t *e       = tt_probe(ctx->tt, G->hash);
+    if (e) {
+        tt_move = e->move;
+        if (ply > 0 && e->depth >= depth) {
+            int s = score_from_tt(e->score, ply);
+            if (e->bound == TT_BOUND_EXACT ||
+                (e->bound == TT_BOUND_LOWER && s >= beta) ||
+                (e->bound == TT_BOUND_UPPER && s <= alpha))
+                return s;
+        }
+    }
+
+    move_t moves[MAX_LEGAL_MOVES];
+    int    n = generate_legal_moves(G, moves);
+    if (n == 0)
+        return in_check ? -SCORE_MATE + ply : 0;
+    order_moves(G, moves, n, tt_move);
+
+    int    orig_alpha = alpha;
+    int    best       = -SCORE_MATE - 1;
+    move_t best_move  = MOVE_NONE;
+
+    for (int i = 0; i < n; i++) {
+        game_t child = *G;
+        apply_move(&child, moves[i]);
+
+        ctx->path[ctx->path_len++] = child.hash;
+        int score                  = -alpha_beta(ctx, &child, depth - 1, -beta, -alpha, ply + 1, NULL);
+        ctx->path_len--;
+
+        if (ctx->stopped)
+            return 0;
+        if (score > best) {
+            best      = score;
+            best_move = moves[i];
+            if (score > alpha) {
+                alpha = score;
+                if (score >= beta)
+                    break;
+            }
+        }
+    }
+
+    int bound = best >= beta ? TT_BOUND_LOWER : (best > orig_alpha ? TT_BOUND_EXACT : TT_BOUND_UPPER);
+    tt_store(ctx->tt, G->hash, best_move, best, depth, bound, ply);
+
+    if (best_out)
+        *best_out = best_move;
+    return best;
+}
+
+bool search_best_move(const game_t *G, const search_limits_t *limits, tt_t *tt, search_result_t *result) {
+    search_ctx_t *ctx = calloc(1, sizeof(search_ctx_t));
+    if (!ctx)
+        return false;
+
+    int64_t start_ms = monotonic_ms();
+    ctx->tt          = tt;
+    ctx->deadline_ms = limits->time_ms > 0 ? start_ms + limits->time_ms : 0;
+
+    // 게임 기록을 경로 앞에 두어 실제 대국에서의 반복도 무승부로 본다
+    game_t root  = *G;
+    root.history = NULL;
+    if (G->history) {
+        memcpy(ctx->path, G->history->hashes, G->history->count * sizeof(uint64_t));
+        ctx->path_len = G->history->count;
+    }
+    if (ctx->path_len == 0 || ctx->path[ctx->path_len - 1] != root.hash)
+        ctx->path[ctx->path_len++] = root.hash;
+
+    int max_depth = limits->max_depth > 0 ? limits->max_depth : SEARCH_MAX_DEPTH;
+    if (max_depth > SEARCH_MAX_DEPTH)
+        max_depth = SEARCH_MAX_DEPTH;
+
+    memset(result, 0, sizeof(*result));
+
+    move_t moves[MAX_LEGAL_MOVES];
+    int    n = generate_legal_moves(&root, moves);
+    if (n == 0) {
+        result->score = is_in_check(&root, root.side_to_move) ? -SCORE_MATE : 0;
+        free(ctx);
+        return false;
+    }
+
+    // 합법 수가 하나뿐이면 탐색할 필요 없음
+    result->best = moves[0];
+    if (n == 1) {
+        result->score = evaluate(&root);
+        free(ctx);
+        return true;
+    }
+
+    for (int depth = 1; depth <= max_depth; depth++) {
+        move_t best  = MOVE_NONE;
+        int    score = alpha_beta(ctx, &root, depth, -SCORE_MATE - 1, SCORE_MATE + 1, 0, &best);
+        if (ctx->stopped || best == MOVE_NONE)
+            break;
+
+        result->best  = best;
+        result->score = score;
+        result->depth = depth;
+
+        // 메이트를 찾았거나, 다음 반복을 끝낼 시간이 없어 보이면 멈춘다
+        if (score >= SCORE_MATE_MIN || score <= -SCORE_MATE_MIN)
+            break;
+        if (ctx->deadline_ms && monotonic_ms() - start_ms > limits->time_ms / 2)
+            break;
+    }
+
+    result->nodes = ctx->nodes;
+    free(ctx);
+    return true;
+}
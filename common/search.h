@@ -0,0 +1,71 @@
+// search.h
+#ifndef COMMON_SEARCH_H
+#define COMMON_SEARCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "move.h"
+#include "rule.h"
+
+// 탐색 최대 깊이 (반복 심화 상한)
+#define SEARCH_MAX_DEPTH 32
+
+// 체크메이트 점수 (센티폰, 남은 수만큼 깎아서 빠른 메이트를 선호)
+#define SCORE_MATE     30000
+#define SCORE_MATE_MIN (SCORE_MATE - 256)
+
+// 치환표 한 칸 (16바이트)
+typedef struct {
+    uint64_t key;    // 국면 해시 (game_t.hash)
+    move_t   move;   // 최선 수 (없으면 MOVE_NONE)
+    int16_t  score;  // 평가값 (메이트 점수는 저장 시 루트 기준에서 노드 기준으로 보정)
+    int8_t   depth;  // 남은 탐색 깊이
+    uint8_t  bound;  // TT_BOUND_*
+} tt_entry_t;
+
+enum {
+    TT_BOUND_NONE  = 0,
+    TT_BOUND_EXACT = 1,
+    TT_BOUND_LOWER = 2,  // score 이상 (beta 컷)
+    TT_BOUND_UPPER = 3   // score 이하 (alpha 미달)
+};
+
+// 치환표 (스레드마다 하나씩 두므로 잠금 없음)
+typedef struct {
+    tt_entry_t *entries;
+    size_t      mask;  // 칸 수 - 1 (칸 수는 2의 거듭제곱)
+} tt_t;
+
+// size_mb 이하에서 가장 큰 2의 거듭제곱 칸 수로 할당, 실패 시 false
+bool tt_init(tt_t *tt, size_t size_mb);
+void tt_free(tt_t *tt);
+void tt_clear(tt_t *tt);
+
+// 호출한 스레드 전용 치환표 (처음 호출할 때 size_mb로 할당, 스레드가 끝나면 해제)
+// 워커 스레드끼리 잠금 없이 쓰고, 같은 스레드의 다음 탐색이 이전 결과를 재사용한다
+tt_t *tt_thread_local(size_t size_mb);
+
+// 탐색 제한 (0이면 제한 없음, 둘 다 0이면 깊이 SEARCH_MAX_DEPTH까지)
+typedef struct {
+    int max_depth;  // 반복 심화 최대 깊이
+    int time_ms;    // 시간 예산 (밀리초)
+} search_limits_t;
+
+// 탐색 결과 (마지막으로 끝까지 마친 반복의 결과)
+typedef struct {
+    move_t   best;   // 최선 수 (합법 수가 없으면 MOVE_NONE)
+    int      score;  // side_to_move 기준 평가값 (센티폰)
+    int      depth;  // 완료한 깊이
+    uint64_t nodes;  // 방문한 노드 수
+} search_result_t;
+
+// 정적 평가 (기물 가치 + 위치 가산점, side_to_move 기준 센티폰)
+int evaluate(const game_t *G);
+
+// 반복 심화 알파-베타 탐색으로 최선 수를 찾는다
+// 합법 수가 없으면 false (result->score는 메이트/스테일메이트 점수)
+bool search_best_move(const game_t *G, const search_limits_t *limits, tt_t *tt, search_result_t *result);
+
+#endif  // COMMON_SEARCH_H
@@ -0,0 +1,176 @@
+// gen_attack_tables.c
+// 빌드 시 실행되어 공격/광선 테이블과 Zobrist 키 헤더(attack_tables.h)를 생성한다
+// 사용법: gen_attack_tables <출력 파일>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// 칸 번호는 move.h 의 SQUARE(x, y)와 동일 (rank * 8 + file)
+#define SQ(x, y) ((y) * 8 + (x))
+
+static const int knight_offsets[8][2] = {
+    {1, 2}, {2, 1}, {2, -1}, {1, -2}, {-1, -2}, {-2, -1}, {-2, 1}, {-1, 2}};
+static const int king_offsets[8][2] = {
+    {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}};
+
+static uint64_t knight_attacks[64];
+static uint64_t king_attacks[64];
+static uint64_t pawn_attacks[2][64];
+static uint64_t between_bb[64][64];
+static uint64_t line_bb[64][64];
+
+// Zobrist 키 (고정 시드 splitmix64, 빌드마다 같은 값)
+//   zobrist_pieces[team * 6 + piece_type][sq], 흑 차례, 캐슬링 권리 K/Q/k/q, 앙파상 파일
+static uint64_t zobrist_pieces[12][64];
+static uint64_t zobrist_misc[1 + 4 + 8];
+
+static int in_board(int x, int y) {
+    return x >= 0 && x < 8 && y >= 0 && y < 8;
+}
+
+static uint64_t offsets_bb(int x, int y, const int (*offsets)[2], int n) {
+    uint64_t bb = 0;
+    for (int k = 0; k < n; k++) {
+        int nx = x + offsets[k][0], ny = y + offsets[k][1];
+        if (in_board(nx, ny))
+            bb |= 1ULL << SQ(nx, ny);
+    }
+    return bb;
+}
+
+static int sign(int v) {
+    return (v > 0) - (v < 0);
+}
+
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z          = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void build_zobrist(void) {
+    uint64_t state = 0x6d756c7469636865ULL;
+    for (int p = 0; p < 12; p++)
+        for (int sq = 0; sq < 64; sq++)
+            zobrist_pieces[p][sq] = splitmix64(&state);
+    for (int i = 0; i < (int)(sizeof(zobrist_misc) / sizeof(zobrist_misc[0])); i++)
+        zobrist_misc[i] = splitmix64(&state);
+}
+
+static void build_tables(void) {
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            int s             = SQ(x, y);
+            knight_attacks[s] = offsets_bb(x, y, knight_offsets, 8);
+            king_attacks[s]   = offsets_bb(x, y, king_offsets, 8);
+
+            // 폰 공격: 흰색은 위(+1), 흑색은 아래(-1) 대각선
+            for (int team = 0; team < 2; team++) {
+                int dir = team == 0 ? +1 : -1;
+                for (int dx = -1; dx <= 1; dx += 2)
+                    if (in_board(x + dx, y + dir))
+                        pawn_attacks[team][s] |= 1ULL << SQ(x + dx, y + dir);
+            }
+        }
+    }
+
+    // 두 칸이 같은 랭크/파일/대각선에 있을 때만 값이 있다
+    for (int a = 0; a < 64; a++) {
+        for (int b = 0; b < 64; b++) {
+            if (a == b)
+                continue;
+            int ax = a & 7, ay = a >> 3, bx = b & 7, by = b >> 3;
+            int rx = bx - ax, ry = by - ay;
+            if (!(rx == 0 || ry == 0 || rx == ry || rx == -ry))
+                continue;
+
+            int sx = sign(rx), sy = sign(ry);
+
+            // 사이 칸 (양 끝 제외)
+            for (int x = ax + sx, y = ay + sy; x != bx || y != by; x += sx, y += sy)
+                between_bb[a][b] |= 1ULL << SQ(x, y);
+
+            // 두 칸을 지나는 직선 전체 (양 끝 포함, 보드 끝까지)
+            int x = ax, y = ay;
+            while (in_board(x - sx, y - sy)) {
+                x -= sx;
+                y -= sy;
+            }
+            for (; in_board(x, y); x += sx, y += sy)
+                line_bb[a][b] |= 1ULL << SQ(x, y);
+        }
+    }
+}
+
+static void write_array(FILE *f, const char *name, const uint64_t *v, int n) {
+    fprintf(f, "static const uint64_t %s[%d] = {", name, n);
+    for (int i = 0; i < n; i++)
+        fprintf(f, "%s0x%016" PRIx64 "ULL%s", i % 4 ? " " : "\n    ", v[i], i + 1 < n ? "," : "");
+    fprintf(f, "};\n\n");
+}
+
+static void write_matrix(FILE *f, const char *name, uint64_t (*v)[64], int rows) {
+    fprintf(f, "static const uint64_t %s[%d][64] = {\n", name, rows);
+    for (int r = 0; r < rows; r++) {
+        fprintf(f, "    {");
+        for (int i = 0; i < 64; i++)
+            fprintf(f, "%s0x%016" PRIx64 "ULL%s", i % 4 ? " " : "\n        ", v[r][i], i + 1 < 64 ? "," : "");
+        fprintf(f, "}%s\n", r + 1 < rows ? "," : "");
+    }
+    fprintf(f, "};\n\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <output header>\n", argv[0]);
+        return 1;
+    }
+
+    build_tables();
+    build_zobrist();
+
+    FILE *f = fopen(argv[1], "w");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(f,
+            "// attack_tables.h\n"
+            "// gen_attack_tables 가 빌드 시 생성하는 파일입니다. 직접 수정하지 마세요.\n"
+            "#ifndef COMMON_ATTACK_TABLES_H\n"
+            "#define COMMON_ATTACK_TABLES_H\n\n"
+            "#include <stdint.h>\n\n"
+            "// 칸 번호는 move.h 의 SQUARE(x, y) (rank * 8 + file), 비트 i = 칸 i\n"
+            "#define SQUARE_BB(sq) (1ULL << (sq))\n\n");
+
+    fprintf(f, "// 나이트/킹이 공격하는 칸\n");
+    write_array(f, "knight_attacks", knight_attacks, 64);
+    write_array(f, "king_attacks", king_attacks, 64);
+
+    fprintf(f, "// pawn_attacks[team][sq]: team 폰이 sq에서 공격하는 칸\n");
+    write_matrix(f, "pawn_attacks", pawn_attacks, 2);
+
+    fprintf(f, "// between_bb[a][b]: 같은 랭크/파일/대각선 위 a와 b 사이 칸 (정렬되지 않으면 0)\n");
+    write_matrix(f, "between_bb", between_bb, 64);
+
+    fprintf(f, "// line_bb[a][b]: a와 b를 지나는 직선 전체 (정렬되지 않으면 0)\n");
+    write_matrix(f, "line_bb", line_bb, 64);
+
+    fprintf(f, "// Zobrist 키: zobrist_pieces[team * 6 + piece_type][sq]\n");
+    write_matrix(f, "zobrist_pieces", zobrist_pieces, 12);
+
+    fprintf(f, "// zobrist_misc[ZOBRIST_SIDE]: 흑 차례, [ZOBRIST_CASTLING + 0..3]: K/Q/k/q, [ZOBRIST_EP_FILE + file]: 앙파상\n");
+    fprintf(f, "#define ZOBRIST_SIDE     0\n#define ZOBRIST_CASTLING 1\n#define ZOBRIST_EP_FILE  5\n\n");
+    write_array(f, "zobrist_misc", zobrist_misc, (int)(sizeof(zobrist_misc) / sizeof(zobrist_misc[0])));
+
+    fprintf(f, "#endif  // COMMON_ATTACK_TABLES_H\n");
+
+    if (fclose(f) != 0) {
+        perror(argv[1]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,393 @@
+// logdecode.c
+// 바이너리 로그(LOG_OUTPUT_BINARY, *.blog)를 텍스트 또는 JSON Lines로 변환한다
+// 사용법: logdecode [-j] <로그 파일>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "log_binary.h"
+
+#define MAX_SITES   65536
+#define MESSAGE_MAX 4096
+#define SPEC_MAX    64
+#define MAX_ARGS    64
+
+static const char *level_strings[] = {"DEBUG", "INFO", "WARN", "ERROR", "FATAL"};
+
+// 호출 위치 (id로 바로 찾는다)
+typedef struct {
+    char *format;
+    char *file;
+    char *func;
+    int   line;
+} site_t;
+
+// 디코딩한 인자 하나
+typedef struct {
+    uint8_t     type;
+    int64_t     i;
+    uint64_t    u;
+    double      d;
+    const char *s;
+    uint16_t    s_len;
+} arg_t;
+
+static site_t sites[MAX_SITES];
+
+static char *dup_bytes(const unsigned char *p, size_t n) {
+    char *s = malloc(n + 1);
+    if (!s) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(s, p, n);
+    s[n] = '\0';
+    return s;
+}
+
+// EVENT 본문의 인자를 순서대로 푼다 (반환값은 인자 수, 깨졌으면 -1)
+static int decode_args(const unsigned char *p, size_t len, arg_t *args) {
+    const unsigned char *end = p + len;
+    int                  n   = 0;
+
+    while (p < end && n < MAX_ARGS) {
+        arg_t *a = &args[n];
+        a->type  = *p++;
+        switch (a->type) {
+            case LOG_ARG_INT:
+            case LOG_ARG_UINT:
+            case LOG_ARG_POINTER:
+            case LOG_ARG_DOUBLE:
+                if ((size_t)(end - p) < 8)
+                    return -1;
+                if (a->type == LOG_ARG_INT)
+                    memcpy(&a->i, p, 8);
+                else if (a->type == LOG_ARG_DOUBLE)
+                    memcpy(&a->d, p, 8);
+                else
+                    memcpy(&a->u, p, 8);
+                p += 8;
+                break;
+            case LOG_ARG_STRING:
+                if ((size_t)(end - p) < sizeof(uint16_t))
+                    return -1;
+                memcpy(&a->s_len, p, sizeof(uint16_t));
+                p += sizeof(uint16_t);
+                if ((size_t)(end - p) < a->s_len)
+                    return -1;
+                a->s = (const char *)p;
+                p += a->s_len;
+                break;
+            default:
+                return -1;
+        }
+        n++;
+    }
+    return n;
+}
+
+// out[*len]부터 이어서 쓴다 (넘치면 잘라 낸다)
+static void emit(char *out, size_t size, size_t *len, const char *format, ...) {
+    if (*len + 1 >= size)
+        return;
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(out + *len, size - *len, format, args);
+    va_end(args);
+    if (n > 0)
+        *len += ((size_t)n < size - *len) ? (size_t)n : size - *len - 1;
+}
+
+// 형식 문자열에 인자를 다시 채워 메시지를 만든다 (logger의 encode_args와 같은 순서로 소비)
+static void render_message(const char *format, const arg_t *args, int nargs, char *out, size_t size) {
+    size_t len  = 0;
+    int    next = 0;
+
+    for (const char *p = format; *p && len + 1 < size; p++) {
+        if (*p != '%') {
+            out[len++] = *p;
+            continue;
+        }
+        if (p[1] == '%') {
+            out[len++] = '%';
+            p++;
+            continue;
+        }
+
+        // 플래그/너비/정밀도는 그대로 옮기고 '*'는 인자 값으로 바꾼다, 길이 수식어는 버린다
+        char   spec[SPEC_MAX];
+        size_t sl   = 0;
+        spec[sl++]  = *p++;
+        while (*p && strchr("-+ #0'", *p) && sl < SPEC_MAX - 24)
+            spec[sl++] = *p++;
+        for (int part = 0; part < 2; part++) {
+            if (part == 1) {
+                if (*p != '.')
+                    break;
+                spec[sl++] = *p++;
+            }
+            if (*p == '*') {
+                long long v = (next < nargs && args[next].type == LOG_ARG_INT) ? args[next].i : 0;
+                next++;
+                sl += (size_t)snprintf(spec + sl, SPEC_MAX - sl, "%lld", v);
+                p++;
+            }
+            while (*p >= '0' && *p <= '9' && sl < SPEC_MAX - 24)
+                spec[sl++] = *p++;
+        }
+        while (*p && strchr("hlzjtL", *p))
+            p++;
+        if (!*p)
+            break;
+
+        char conv = *p;
+        if (next >= nargs) {
+            emit(out, size, &len, "<?>");
+            continue;
+        }
+        const arg_t *a = &args[next++];
+
+        switch (conv) {
+            case 'd':
+            case 'i':
+                memcpy(spec + sl, "lld", 4);
+                emit(out, size, &len, spec, (long long)a->i);
+                break;
+            case 'c':
+                spec[sl++] = 'c';
+                spec[sl]   = '\0';
+                emit(out, size, &len, spec, (int)a->i);
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+                spec[sl++] = 'l';
+                spec[sl++] = 'l';
+                spec[sl++] = conv;
+                spec[sl]   = '\0';
+                emit(out, size, &len, spec, (unsigned long long)a->u);
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                spec[sl++] = conv;
+                spec[sl]   = '\0';
+                emit(out, size, &len, spec, a->d);
+                break;
+            case 's': {
+                // 저장된 문자열은 이미 정밀도만큼 잘려 있다
+                char *str  = dup_bytes((const unsigned char *)a->s, a->s_len);
+                spec[sl++] = 's';
+                spec[sl]   = '\0';
+                emit(out, size, &len, spec, str);
+                free(str);
+                break;
+            }
+            case 'p':
+                emit(out, size, &len, "%p", (void *)(uintptr_t)a->u);
+                break;
+            default:
+                emit(out, size, &len, "<?>");
+                break;
+        }
+    }
+    out[len < size ? len : size - 1] = '\0';
+}
+
+static void print_json_string(const char *s) {
+    putchar('"');
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\')
+            printf("\\%c", c);
+        else if (c == '\n')
+            fputs("\\n", stdout);
+        else if (c == '\t')
+            fputs("\\t", stdout);
+        else if (c < 0x20)
+            printf("\\u%04x", c);
+        else
+            putchar(c);
+    }
+    putchar('"');
+}
+
+static void print_event(const log_binary_header_t *header, const log_event_t *ev, int level,
+                        const unsigned char *argp, size_t arg_len, bool json) {
+    const site_t *site = (ev->site_id < MAX_SITES) ? &sites[ev->site_id] : NULL;
+    if (!site || !site->format) {
+        fprintf(stderr, "logdecode: event refers to unknown site %" PRIu32 "\n", ev->site_id);
+        return;
+    }
+
+    arg_t args[MAX_ARGS];
+    int   nargs = decode_args(argp, arg_len, args);
+    if (nargs < 0) {
+        fprintf(stderr, "logdecode: malformed arguments for site %" PRIu32 "\n", ev->site_id);
+        return;
+    }
+
+    char message[MESSAGE_MAX];
+    render_message(site->format, args, nargs, message, sizeof(message));
+
+    // 단조 시계 값을 헤더 기준점으로 벽시계로 옮긴다
+    int64_t   real_ns = header->realtime_ns + (ev->ts_ns - header->monotonic_ns);
+    time_t    sec     = (time_t)(real_ns / 1000000000LL);
+    struct tm tm;
+    char      timestamp[32];
+    localtime_r(&sec, &tm);
+    strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &tm);
+    int         millis     = (int)((real_ns / 1000000LL) % 1000);
+    const char *level_name = (level >= 0 && level <= 4) ? level_strings[level] : "?";
+
+    if (!json) {
+        printf("[%s.%03d] [%s] %s:%d %s() - %s\n", timestamp, millis, level_name,
+               site->file, site->line, site->func, message);
+        return;
+    }
+
+    printf("{\"ts\":\"%s.%03d\",\"ts_ns\":%" PRId64 ",\"level\":\"%s\",\"file\":", timestamp, millis, real_ns, level_name);
+    print_json_string(site->file);
+    printf(",\"line\":%d,\"func\":", site->line);
+    print_json_string(site->func);
+    fputs(",\"format\":", stdout);
+    print_json_string(site->format);
+    fputs(",\"msg\":", stdout);
+    print_json_string(message);
+    fputs(",\"args\":[", stdout);
+    for (int i = 0; i < nargs; i++) {
+        if (i > 0)
+            putchar(',');
+        switch (args[i].type) {
+            case LOG_ARG_INT:
+                printf("%" PRId64, args[i].i);
+                break;
+            case LOG_ARG_UINT:
+            case LOG_ARG_POINTER:
+                printf("%" PRIu64, args[i].u);
+                break;
+            case LOG_ARG_DOUBLE:
+                printf("%.17g", args[i].d);
+                break;
+            case LOG_ARG_STRING: {
+                char *str = dup_bytes((const unsigned char *)args[i].s, args[i].s_len);
+                print_json_string(str);
+                free(str);
+                break;
+            }
+        }
+    }
+    fputs("]}\n", stdout);
+}
+
+int main(int argc, char *argv[]) {
+    bool        json = false;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-j") == 0)
+            json = true;
+        else
+            path = argv[i];
+    }
+    if (!path) {
+        fprintf(stderr, "Usage: %s [-j] <log.blog>\n", argv[0]);
+        return 1;
+    }
+
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        perror(path);
+        return 1;
+    }
+
+    log_binary_header_t header;
+    if (fread(&header, sizeof(header), 1, fp) != 1 || header.magic != LOG_BINARY_MAGIC) {
+        fprintf(stderr, "%s: not a binary log file\n", path);
+        fclose(fp);
+        return 1;
+    }
+    if (header.version != LOG_BINARY_VERSION) {
+        fprintf(stderr, "%s: unsupported version %" PRIu32 "\n", path, header.version);
+        fclose(fp);
+        return 1;
+    }
+
+    unsigned char   *body     = NULL;
+    size_t           body_cap = 0;
+    log_rec_header_t rec;
+    while (fread(&rec, sizeof(rec), 1, fp) == 1) {
+        if (rec.length > body_cap) {
+            unsigned char *grown = realloc(body, rec.length);
+            if (!grown) {
+                perror("realloc");
+                break;
+            }
+            body     = grown;
+            body_cap = rec.length;
+        }
+        if (rec.length > 0 && fread(body, rec.length, 1, fp) != 1) {
+            // 쓰는 도중 끝난 파일은 마지막 레코드가 잘려 있을 수 있다
+            fprintf(stderr, "%s: truncated record at end of file\n", path);
+            break;
+        }
+
+        switch (rec.type) {
+            case LOG_REC_SITE: {
+                log_site_t site;
+                if (rec.length < sizeof(site))
+                    break;
+                memcpy(&site, body, sizeof(site));
+                if (site.id >= MAX_SITES ||
+                    sizeof(site) + (size_t)site.format_len + site.file_len + site.func_len > rec.length)
+                    break;
+                const unsigned char *p = body + sizeof(site);
+                site_t              *s = &sites[site.id];
+                free(s->format);
+                free(s->file);
+                free(s->func);
+                s->format = dup_bytes(p, site.format_len);
+                s->file   = dup_bytes(p + site.format_len, site.file_len);
+                s->func   = dup_bytes(p + site.format_len + site.file_len, site.func_len);
+                s->line   = site.line;
+                break;
+            }
+            case LOG_REC_EVENT: {
+                log_event_t ev;
+                if (rec.length < sizeof(ev))
+                    break;
+                memcpy(&ev, body, sizeof(ev));
+                print_event(&header, &ev, rec.level, body + sizeof(ev), rec.length - sizeof(ev), json);
+                break;
+            }
+            case LOG_REC_DROPPED: {
+                uint32_t count = 0;
+                if (rec.length >= sizeof(count))
+                    memcpy(&count, body, sizeof(count));
+                if (json)
+                    printf("{\"dropped\":%" PRIu32 "}\n", count);
+                else
+                    printf("[logger] %" PRIu32 " log message(s) dropped\n", count);
+                break;
+            }
+            default:
+                fprintf(stderr, "%s: unknown record type %u\n", path, rec.type);
+                break;
+        }
+    }
+
+    free(body);
+    fclose(fp);
+    return 0;
+}
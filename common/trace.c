@@ -0,0 +1,241 @@
+#include "trace.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "logger.h"
+
+#define TRACE_EXPORT_BUFFER (64 * 1024)  // JSON을 모아서 쓰는 단위
+
+_Static_assert((TRACE_RING_EVENTS & (TRACE_RING_EVENTS - 1)) == 0, "ring size must be a power of two");
+
+typedef struct {
+    uint64_t    ts_ns;  // CLOCK_MONOTONIC
+    const char *name;
+    uint32_t    id;     // 요청 id
+    char        phase;  // 'B' 시작, 'E' 끝
+} trace_event_t;
+
+// 스레드별 링 (소유 스레드만 쓰고, 내보내기는 head를 앞뒤로 읽어 덮어쓰인 칸을 걸러낸다)
+typedef struct {
+    _Alignas(64) atomic_ullong head;  // 지금까지 기록한 이벤트 수
+    _Atomic(trace_event_t *) events;  // 준비가 끝나면 채워진다 (NULL이면 아직 없음)
+    int                      tid;
+} trace_ring_t;
+
+static struct {
+    trace_ring_t rings[TRACE_MAX_THREADS];
+    atomic_int   n_rings;      // 나눠 준 링 수
+    atomic_uint  sample_rate;  // 0이면 끔
+    atomic_uint  next_id;
+} g_trace;
+
+__thread uint32_t t_trace_id;
+
+static __thread trace_ring_t *t_trace_ring;
+static __thread bool          t_trace_no_ring;    // 링을 얻지 못한 스레드는 다시 시도하지 않는다
+static __thread unsigned      t_trace_countdown;  // 다음 표본까지 남은 요청 수
+
+void trace_set_sample_rate(unsigned rate) {
+    atomic_store_explicit(&g_trace.sample_rate, rate, memory_order_relaxed);
+}
+
+unsigned trace_get_sample_rate(void) {
+    return atomic_load_explicit(&g_trace.sample_rate, memory_order_relaxed);
+}
+
+// 호출 스레드의 링 (처음 표본을 뽑을 때 하나 차지하고, 스레드가 끝나도 내보낼 수 있게 남겨 둔다)
+static trace_ring_t *thread_ring(void) {
+    if (t_trace_ring || t_trace_no_ring)
+        return t_trace_ring;
+
+    int index = atomic_fetch_add(&g_trace.n_rings, 1);
+    if (index >= TRACE_MAX_THREADS) {
+        t_trace_no_ring = true;
+        return NULL;
+    }
+
+    trace_event_t *events = calloc(TRACE_RING_EVENTS, sizeof(trace_event_t));
+    if (!events) {
+        t_trace_no_ring = true;
+        return NULL;
+    }
+
+    trace_ring_t *ring = &g_trace.rings[index];
+    ring->tid          = (int)syscall(SYS_gettid);
+    atomic_store_explicit(&ring->events, events, memory_order_release);
+    t_trace_ring = ring;
+    return ring;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+void trace_emit(const char *name, char phase) {
+    trace_ring_t *ring = t_trace_ring;
+    if (!ring)
+        return;
+
+    unsigned long long head  = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    trace_event_t     *event = &atomic_load_explicit(&ring->events, memory_order_relaxed)[head & (TRACE_RING_EVENTS - 1)];
+    event->ts_ns             = now_ns();
+    event->name              = name;
+    event->id                = t_trace_id;
+    event->phase             = phase;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+void trace_request_begin(void) {
+    t_trace_id = 0;
+
+    unsigned rate = atomic_load_explicit(&g_trace.sample_rate, memory_order_relaxed);
+    if (rate == 0)
+        return;
+    if (t_trace_countdown > 1) {
+        t_trace_countdown--;
+        return;
+    }
+    t_trace_countdown = rate;
+
+    if (!thread_ring())
+        return;
+
+    uint32_t id = atomic_fetch_add_explicit(&g_trace.next_id, 1, memory_order_relaxed) + 1;
+    t_trace_id  = id ? id : 1;  // 0은 "추적 안 함" 표식이라 건너뛴다
+    trace_emit("request", 'B');
+}
+
+void trace_request_end(void) {
+    if (!t_trace_id)
+        return;
+    trace_emit("request", 'E');
+    t_trace_id = 0;
+}
+
+// 내보내기 출력 버퍼 (가득 차면 fd에 쓴다)
+typedef struct {
+    int    fd;
+    size_t len;
+    bool   failed;
+    char   buf[TRACE_EXPORT_BUFFER];
+} export_buf_t;
+
+static void export_flush(export_buf_t *out) {
+    size_t done = 0;
+    while (!out->failed && done < out->len) {
+        ssize_t n = write(out->fd, out->buf + done, out->len - done);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            out->failed = true;
+            break;
+        }
+        done += (size_t)n;
+    }
+    out->len = 0;
+}
+
+static void export_printf(export_buf_t *out, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+static void export_printf(export_buf_t *out, const char *format, ...) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(out->buf + out->len, sizeof(out->buf) - out->len, format, args);
+        va_end(args);
+        if (n >= 0 && (size_t)n < sizeof(out->buf) - out->len) {
+            out->len += (size_t)n;
+            return;
+        }
+        export_flush(out);
+    }
+}
+
+int trace_export_json(int fd) {
+    export_buf_t  *out      = malloc(sizeof(export_buf_t));
+    trace_event_t *snapshot = malloc(TRACE_RING_EVENTS * sizeof(trace_event_t));
+    if (!out || !snapshot) {
+        free(out);
+        free(snapshot);
+        return -1;
+    }
+    out->fd     = fd;
+    out->len    = 0;
+    out->failed = false;
+
+    int pid     = getpid();
+    int count   = 0;
+    int n_rings = atomic_load(&g_trace.n_rings);
+    if (n_rings > TRACE_MAX_THREADS)
+        n_rings = TRACE_MAX_THREADS;
+
+    export_printf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (int r = 0; r < n_rings; r++) {
+        trace_ring_t  *ring   = &g_trace.rings[r];
+        trace_event_t *events = atomic_load_explicit(&ring->events, memory_order_acquire);
+        if (!events)
+            continue;
+
+        // 복사 전후의 head로, 복사하는 동안 덮어쓰였을 수 있는 칸을 버린다
+        unsigned long long end   = atomic_load_explicit(&ring->head, memory_order_acquire);
+        unsigned long long first = end > TRACE_RING_EVENTS ? end - TRACE_RING_EVENTS : 0;
+        for (unsigned long long i = first; i < end; i++)
+            snapshot[i - first] = events[i & (TRACE_RING_EVENTS - 1)];
+        atomic_thread_fence(memory_order_acquire);
+        unsigned long long now   = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        unsigned long long valid = now + 1 > first + TRACE_RING_EVENTS ? now + 1 - TRACE_RING_EVENTS : first;
+
+        for (unsigned long long i = valid; i < end; i++) {
+            trace_event_t *event = &snapshot[i - first];
+            export_printf(out, "%s\n{\"name\":\"%s\",\"cat\":\"chess\",\"ph\":\"%c\",\"ts\":%" PRIu64 ".%03u,"
+                               "\"pid\":%d,\"tid\":%d,\"args\":{\"request\":%u}}",
+                          count ? "," : "", event->name, event->phase, event->ts_ns / 1000,
+                          (unsigned)(event->ts_ns % 1000), pid, ring->tid, event->id);
+            count++;
+        }
+    }
+    export_printf(out, "\n]}\n");
+    export_flush(out);
+
+    bool failed = out->failed;
+    free(out);
+    free(snapshot);
+    return failed ? -1 : count;
+}
+
+int trace_write_file(const char *prefix) {
+    if (trace_get_sample_rate() == 0 && atomic_load(&g_trace.n_rings) == 0)
+        return 0;
+
+    char path[256];
+    mkdir("logs", 0755);
+    snprintf(path, sizeof(path), "logs/%s_%d.trace.json", prefix ? prefix : "app", getpid());
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        LOG_WARN("Failed to open trace file %s: %s", path, strerror(errno));
+        return -1;
+    }
+    int count = trace_export_json(fd);
+    close(fd);
+
+    if (count < 0) {
+        LOG_WARN("Failed to write trace file %s", path);
+        return -1;
+    }
+    LOG_INFO("Trace written: %s (%d events)", path, count);
+    return count;
+}
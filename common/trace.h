@@ -0,0 +1,53 @@
+#ifndef COMMON_TRACE_H
+#define COMMON_TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// 요청 단위 경량 트레이싱
+// 표본으로 뽑힌 요청만 구간 시작/끝을 스레드별 링에 남기고, 필요할 때 Chrome trace-event JSON으로 내보낸다
+// 링은 가득 차면 가장 오래된 이벤트부터 덮어쓴다 (항상 켜 두는 비행 기록기)
+//
+//   trace_request_begin();      // 표본 여부 결정 (뽑히지 않으면 아래 매크로는 분기 하나로 끝난다)
+//   TRACE_BEGIN("receive");
+//   ...
+//   TRACE_END("receive");
+//   trace_request_end();
+
+#define TRACE_MAX_THREADS 64
+#define TRACE_RING_EVENTS 4096  // 스레드별 보관 이벤트 수 (2의 거듭제곱)
+
+// 현재 스레드에서 추적 중인 요청 id (0이면 추적하지 않음)
+extern __thread uint32_t t_trace_id;
+
+// 스레드마다 rate번째 요청마다 하나씩 표본으로 뽑는다 (0이면 끔, 1이면 전부)
+void     trace_set_sample_rate(unsigned rate);
+unsigned trace_get_sample_rate(void);
+
+// 요청 시작/끝 (시작에서 표본으로 뽑히면 "request" 구간이 열린다)
+void trace_request_begin(void);
+void trace_request_end(void);
+
+// name은 문자열 리터럴이어야 한다 (포인터만 저장)
+void trace_emit(const char *name, char phase);
+
+#define TRACE_BEGIN(name)            \
+    do {                             \
+        if (t_trace_id)              \
+            trace_emit((name), 'B'); \
+    } while (0)
+
+#define TRACE_END(name)              \
+    do {                             \
+        if (t_trace_id)              \
+            trace_emit((name), 'E'); \
+    } while (0)
+
+// 모든 스레드의 링을 Chrome trace-event JSON으로 fd에 쓴다, 반환값은 쓴 이벤트 수 (실패하면 -1)
+// 기록 중인 스레드와 동시에 호출해도 되며, 읽는 동안 덮어쓰인 이벤트는 건너뛴다
+int trace_export_json(int fd);
+
+// logs/<prefix>_<pid>.trace.json에 내보낸다 (추적이 꺼져 있고 이벤트도 없으면 아무것도 하지 않음)
+int trace_write_file(const char *prefix);
+
+#endif  // COMMON_TRACE_H
@@ -13,12 +13,8 @@ static inline bool in_board(int x, int y) {
 
 void clear_board(game_t* G) {
     for (int y = 0; y < 8; y++)
-        for (int x = 0; x < 8; x++) {
-            G->board[y][x].piece     = NULL;
-            G->board[y][x].team      = TEAM_WHITE;
-            G->board[y][x].is_dead   = 1;
-            G->board[y][x].has_moved = false;
-        }
+        for (int x = 0; x < 8; x++)
+            G->board[y][x] = EMPTY_SQUARE;
 }
 
 void init_startpos(game_t* G) {
@@ -31,6 +27,8 @@ void init_startpos(game_t* G) {
 bool fen_parse(game_t* G, const char* fen) {
     clear_board(G);
     // 토큰 분리: 6 필드 (piece, side, castling, ep, halfmove, fullmove)
+    G->fullmove_number = 1;  // 필드가 생략된 FEN 대비 기본값
+    G->history         = NULL;
     char* s = strdup(fen);
     if (!s) return false;
     char* tok = NULL;
@@ -73,11 +71,7 @@ bool fen_parse(game_t* G, const char* fen) {
                                 free(s);
                                 return false;
                         }
-                        piece_t* piece           = piece_table[team][type];
-                        G->board[y][x].piece     = piece;
-                        G->board[y][x].team      = team;
-                        G->board[y][x].is_dead   = 0;
-                        G->board[y][x].has_moved = false;
+                        G->board[y][x] = piece_make(team, type);
                         x++;
                     }
                 }
@@ -113,11 +107,96 @@ bool fen_parse(game_t* G, const char* fen) {
             case 4:  // halfmove clock
                 G->halfmove_clock = atoi(tok);
                 break;
-                // case 5: fullmove number: 무시
+            case 5:  // fullmove number
+                G->fullmove_number = atoi(tok);
+                if (G->fullmove_number < 1)
+                    G->fullmove_number = 1;
+                break;
         }
         fld++;
         tok = strtok(NULL, " ");
     }
     free(s);
+
+    // 해시와 기물 수는 보드가 모두 채워진 뒤 계산
+    memset(G->piece_count, 0, sizeof(G->piece_count));
+    for (int y = 0; y < 8; y++)
+        for (int x = 0; x < 8; x++)
+            if (!piece_is_empty(G->board[y][x]))
+                G->piece_count[piece_team(G->board[y][x])][piece_type(G->board[y][x])]++;
+    G->hash = position_hash(G);
+
     return (fld >= 5);
 }
+
+// FEN 기물 문자 (piece_type_t 순서, 흰색 대문자)
+static const char fen_piece_chars[2][6] = {
+    {'P', 'N', 'B', 'R', 'Q', 'K'},
+    {'p', 'n', 'b', 'r', 'q', 'k'}};
+
+// 음이 아닌 정수를 10진수로 기록하고 다음 위치를 반환
+static char* write_uint(char* p, int v) {
+    char tmp[12];
+    int  n = 0;
+    if (v < 0) v = 0;
+    do {
+        tmp[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v > 0);
+    while (n > 0) *p++ = tmp[--n];
+    return p;
+}
+
+int fen_write(const game_t* G, char* out) {
+    char* p = out;
+
+    // 1. 기물 배치 (8랭크부터)
+    for (int y = 7; y >= 0; y--) {
+        int empty = 0;
+        for (int x = 0; x < 8; x++) {
+            piecestate_t sq = G->board[y][x];
+            if (piece_is_empty(sq)) {
+                empty++;
+                continue;
+            }
+            if (empty) {
+                *p++  = (char)('0' + empty);
+                empty = 0;
+            }
+            *p++ = fen_piece_chars[piece_team(sq)][piece_type(sq)];
+        }
+        if (empty) *p++ = (char)('0' + empty);
+        if (y > 0) *p++ = '/';
+    }
+
+    // 2. 차례
+    *p++ = ' ';
+    *p++ = (G->side_to_move == TEAM_WHITE) ? 'w' : 'b';
+
+    // 3. 캐슬링 권리
+    *p++     = ' ';
+    char* cr = p;
+    if (G->white_can_castle_kingside) *p++ = 'K';
+    if (G->white_can_castle_queenside) *p++ = 'Q';
+    if (G->black_can_castle_kingside) *p++ = 'k';
+    if (G->black_can_castle_queenside) *p++ = 'q';
+    if (p == cr) *p++ = '-';
+
+    // 4. 앙파상 칸
+    *p++ = ' ';
+    if (in_board(G->en_passant_x, G->en_passant_y)) {
+        *p++ = (char)('a' + G->en_passant_x);
+        *p++ = (char)('1' + G->en_passant_y);
+    } else {
+        *p++ = '-';
+    }
+
+    // 5, 6. 반수 / 풀수
+    *p++ = ' ';
+    p    = write_uint(p, G->halfmove_clock);
+    *p++ = ' ';
+    p    = write_uint(p, G->fullmove_number > 0 ? G->fullmove_number : 1);
+
+    *p = '\0';
+    return (int)(p - out);
+}
@@ -16,4 +16,11 @@ void init_startpos(game_t* G);
 // 성공 시 true, 포맷 오류 시 false
 bool fen_parse(game_t* G, const char* fen);
 
+// FEN 문자열 버퍼 크기 (최대 길이 + NUL 여유)
+#define FEN_MAX_LEN 128
+
+// game_t 를 FEN 문자열로 직렬화 (out은 FEN_MAX_LEN 이상, 동적 할당 없음)
+// NUL을 제외한 길이를 반환
+int fen_write(const game_t* G, char* out);
+
 #endif  // UTILS_H
@@ -0,0 +1,429 @@
+#include "admin_server.h"
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "clock.h"
+#include "config.h"
+#include "logger.h"
+#include "match_manager.h"
+#include "server_network.h"
+#include "utils.h"
+
+#define ADMIN_MAX_CONNECTIONS 4
+#define ADMIN_COMMAND_MAX     256          // 명령 한 줄 최대 길이
+#define ADMIN_OUTPUT_MAX      (16 * 1024)  // 연결별 송신 버퍼
+#define ADMIN_ROW_MAX         512          // 목록 한 줄 최대 길이 (버퍼에 이만큼 남아야 다음 줄을 만든다)
+#define ADMIN_ROWS_PER_TURN   64           // 이벤트 한 번에 만드는 목록 줄 수 (그 사이 잠금을 풀고 루프로 돌아간다)
+
+// 여러 이벤트에 걸쳐 나눠 보내는 목록
+typedef enum {
+    ADMIN_STREAM_NONE,
+    ADMIN_STREAM_GAMES,
+    ADMIN_STREAM_WAITING
+} admin_stream_t;
+
+typedef struct {
+    int            fd;       // -1이면 빈 칸
+    uint32_t       events;   // 지금 epoll에 걸어 둔 이벤트
+    size_t         in_len;
+    char           in[ADMIN_COMMAND_MAX];
+    admin_stream_t stream;   // 진행 중인 목록
+    int            cursor;   // 목록에서 다음에 볼 슬롯
+    int            rows;     // 지금까지 보낸 목록 줄 수
+    size_t         out_len;
+    size_t         out_sent;
+    char           out[ADMIN_OUTPUT_MAX];
+    bool           closing;  // quit: 남은 출력을 보내고 닫는다
+} admin_conn_t;
+
+// 이벤트 루프 스레드에서만 접근하므로 잠금 없음
+static struct {
+    int          listener;
+    char         path[sizeof(((struct sockaddr_un *)0)->sun_path)];
+    admin_conn_t conns[ADMIN_MAX_CONNECTIONS];
+} g_admin = {.listener = -1};
+
+const char *admin_parse_path_from_args(int argc, char *argv[]) {
+    const char *path = DEFAULT_ADMIN_SOCKET;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+            path = argv[i + 1];
+            i++;
+        }
+    }
+    return strcmp(path, "none") == 0 ? NULL : path;
+}
+
+int admin_server_start(int epfd, const char *path) {
+    for (int i = 0; i < ADMIN_MAX_CONNECTIONS; i++)
+        g_admin.conns[i].fd = -1;
+
+    if (!path) {
+        LOG_INFO("Admin socket disabled");
+        return -1;
+    }
+    if (strlen(path) >= sizeof(g_admin.path)) {
+        LOG_ERROR("Admin socket path too long: %s", path);
+        return -1;
+    }
+
+    // 이전 실행이 남긴 소켓 파일만 지운다 (다른 종류의 파일은 건드리지 않음)
+    struct stat st;
+    if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+        unlink(path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        log_perror("admin: socket");
+        return -1;
+    }
+
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    strcpy(addr.sun_path, path);
+
+    // 같은 사용자만 접속할 수 있게 소켓 파일 권한을 0600으로 만든다
+    mode_t old_mask = umask(0177);
+    int    bound    = bind(fd, (struct sockaddr *)&addr, sizeof(addr));
+    umask(old_mask);
+    if (bound < 0 || listen(fd, BACKLOG) < 0) {
+        log_perror("admin: bind/listen");
+        close(fd);
+        return -1;
+    }
+
+    struct epoll_event ev = {.events = EPOLLIN, .data.fd = fd};
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        log_perror("admin: epoll_ctl");
+        close(fd);
+        unlink(path);
+        return -1;
+    }
+
+    strcpy(g_admin.path, path);
+    g_admin.listener = fd;
+    LOG_INFO("Admin socket listening on %s", path);
+    return fd;
+}
+
+static admin_conn_t *find_conn(int fd) {
+    for (int i = 0; i < ADMIN_MAX_CONNECTIONS; i++) {
+        if (g_admin.conns[i].fd == fd)
+            return &g_admin.conns[i];
+    }
+    return NULL;
+}
+
+bool admin_server_owns(int fd) {
+    return fd >= 0 && (fd == g_admin.listener || find_conn(fd) != NULL);
+}
+
+static void close_conn(int epfd, admin_conn_t *conn) {
+    epoll_ctl(epfd, EPOLL_CTL_DEL, conn->fd, NULL);
+    close(conn->fd);
+    conn->fd = -1;
+}
+
+static void accept_admins(int epfd) {
+    while (1) {
+        int fd = accept(g_admin.listener, NULL, NULL);
+        if (fd < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                log_perror("admin: accept");
+            return;
+        }
+        if (set_nonblocking(fd) < 0) {
+            close(fd);
+            continue;
+        }
+
+        admin_conn_t      *conn = find_conn(-1);
+        struct epoll_event ev   = {.events = EPOLLIN, .data.fd = fd};
+        if (!conn || epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            LOG_WARN("Rejecting admin connection fd=%d (too many connections)", fd);
+            close(fd);
+            continue;
+        }
+        *conn = (admin_conn_t){.fd = fd, .events = EPOLLIN};
+        LOG_INFO("Admin client connected: fd=%d", fd);
+    }
+}
+
+// 송신 버퍼에 한 줄 추가 (자리가 없으면 잘린다, 목록은 ADMIN_ROW_MAX 여유를 확인한 뒤에만 쓴다)
+static void reply(admin_conn_t *conn, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+static void reply(admin_conn_t *conn, const char *format, ...) {
+    size_t room = sizeof(conn->out) - conn->out_len;
+    if (room <= 1)
+        return;
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(conn->out + conn->out_len, room, format, args);
+    va_end(args);
+    if (n > 0)
+        conn->out_len += ((size_t)n < room) ? (size_t)n : room - 1;
+}
+
+static const char *side_name(team_t side) {
+    return side == TEAM_WHITE ? "white" : "black";
+}
+
+// 진행 중인 목록을 최대 ADMIN_ROWS_PER_TURN줄 이어서 만든다 (잠금은 이 호출 동안만 잡는다)
+static void continue_stream(admin_conn_t *conn) {
+    int     limit = conn->stream == ADMIN_STREAM_GAMES ? MAX_ACTIVE_GAMES : MAX_WAITING_PLAYERS;
+    int     made  = 0;
+    int64_t now   = clock_wall_sec();
+
+    match_manager_lock();
+    while (conn->cursor < limit && made < ADMIN_ROWS_PER_TURN &&
+           sizeof(conn->out) - conn->out_len > ADMIN_ROW_MAX) {
+        int i = conn->cursor++;
+        if (conn->stream == ADMIN_STREAM_GAMES) {
+            ActiveGame *g = &g_match_manager.active_games[i];
+            if (!g->is_active)
+                continue;
+            reply(conn, "%s white=%s(fd=%d) black=%s(fd=%d) move=%d to_move=%s clock=%d/%dms age=%llds\n",
+                  g->game_id, g->white_player_id, g->white_player_fd, g->black_player_id, g->black_player_fd,
+                  g->game_state.fullmove_number, side_name(g->game_state.side_to_move),
+                  g->white_time_remaining, g->black_time_remaining, (long long)(now - g->game_start_time));
+        } else {
+            WaitingPlayer *p = &g_match_manager.waiting_players[i];
+            if (!p->is_active)
+                continue;
+            reply(conn, "%s fd=%d waiting=%llds\n", p->player_id, p->fd, (long long)(now - p->wait_start_time));
+        }
+        made++;
+        conn->rows++;
+    }
+    match_manager_unlock();
+
+    if (conn->cursor >= limit) {
+        reply(conn, "OK %d %s\n", conn->rows, conn->stream == ADMIN_STREAM_GAMES ? "game(s)" : "waiting player(s)");
+        conn->stream = ADMIN_STREAM_NONE;
+    }
+}
+
+static void start_stream(admin_conn_t *conn, admin_stream_t stream) {
+    conn->stream = stream;
+    conn->cursor = 0;
+    conn->rows   = 0;
+}
+
+static void cmd_game(admin_conn_t *conn, const char *game_id) {
+    if (!game_id) {
+        reply(conn, "ERR usage: game <game_id>\n");
+        return;
+    }
+
+    match_manager_lock();
+    for (int i = 0; i < MAX_ACTIVE_GAMES; i++) {
+        ActiveGame *g = &g_match_manager.active_games[i];
+        if (!g->is_active || strcmp(g->game_id, game_id) != 0)
+            continue;
+
+        char fen[FEN_MAX_LEN];
+        fen_write(&g->game_state, fen);
+        reply(conn, "fen %s\n", fen);
+        reply(conn, "white %s fd=%d clock=%dms\n", g->white_player_id, g->white_player_fd, g->white_time_remaining);
+        reply(conn, "black %s fd=%d clock=%dms\n", g->black_player_id, g->black_player_fd, g->black_time_remaining);
+        reply(conn, "to_move %s\n", side_name(g->game_state.side_to_move));
+        reply(conn, "vs_bot %s\n", g->vs_bot ? "yes" : "no");
+        match_manager_unlock();
+        reply(conn, "OK\n");
+        return;
+    }
+    match_manager_unlock();
+    reply(conn, "ERR no such game: %s\n", game_id);
+}
+
+static void cmd_loglevel(admin_conn_t *conn, const char *level_name) {
+    if (level_name) {
+        int level = logger_parse_level(level_name);
+        if (level < 0) {
+            reply(conn, "ERR invalid log level: %s\n", level_name);
+            return;
+        }
+        logger_set_level((log_level_t)level);
+        LOG_INFO("Log level set to %s via admin socket", logger_level_name((log_level_t)level));
+    }
+    reply(conn, "OK %s\n", logger_level_name(logger_get_level()));
+}
+
+static void cmd_end(admin_conn_t *conn, const char *game_id) {
+    if (!game_id) {
+        reply(conn, "ERR usage: end <game_id>\n");
+        return;
+    }
+    if (force_end_game(game_id) < 0)
+        reply(conn, "ERR no such game: %s\n", game_id);
+    else
+        reply(conn, "OK game %s ended\n", game_id);
+}
+
+static void cmd_help(admin_conn_t *conn) {
+    reply(conn,
+          "games              list active games\n"
+          "waiting            list players waiting for a match\n"
+          "game <id>          FEN, players and clocks of one game\n"
+          "loglevel [level]   show or set the log level (debug|info|warn|error|fatal)\n"
+          "drain              stop accepting players, exit when the last game ends\n"
+          "end <id>           force-end a game\n"
+          "quit               close this connection\n"
+          "OK\n");
+}
+
+// 명령 한 줄 실행 (목록 명령은 스트림만 열고 실제 출력은 continue_stream이 나눠서 한다)
+static void run_command(admin_conn_t *conn, char *line) {
+    char *save = NULL;
+    char *cmd  = strtok_r(line, " \t", &save);
+    char *arg  = strtok_r(NULL, " \t", &save);
+    if (!cmd)
+        return;
+
+    LOG_DEBUG("Admin command from fd=%d: %s%s%s", conn->fd, cmd, arg ? " " : "", arg ? arg : "");
+
+    if (strcmp(cmd, "games") == 0) {
+        start_stream(conn, ADMIN_STREAM_GAMES);
+    } else if (strcmp(cmd, "waiting") == 0) {
+        start_stream(conn, ADMIN_STREAM_WAITING);
+    } else if (strcmp(cmd, "game") == 0) {
+        cmd_game(conn, arg);
+    } else if (strcmp(cmd, "loglevel") == 0) {
+        cmd_loglevel(conn, arg);
+    } else if (strcmp(cmd, "drain") == 0) {
+        server_request_drain();
+        reply(conn, "OK draining, %d active game(s)\n", get_active_games_count());
+    } else if (strcmp(cmd, "end") == 0) {
+        cmd_end(conn, arg);
+    } else if (strcmp(cmd, "help") == 0) {
+        cmd_help(conn);
+    } else if (strcmp(cmd, "quit") == 0) {
+        reply(conn, "OK bye\n");
+        conn->closing = true;
+    } else {
+        reply(conn, "ERR unknown command: %s (try help)\n", cmd);
+    }
+}
+
+// 받아 둔 입력에서 완성된 줄을 하나씩 실행 (목록 출력이 시작되면 끝날 때까지 다음 명령은 기다린다)
+static void run_pending_commands(admin_conn_t *conn) {
+    while (conn->stream == ADMIN_STREAM_NONE && !conn->closing &&
+           sizeof(conn->out) - conn->out_len > ADMIN_ROW_MAX) {
+        char *newline = memchr(conn->in, '\n', conn->in_len);
+        if (!newline)
+            return;
+
+        *newline    = '\0';
+        size_t used = (size_t)(newline - conn->in) + 1;
+        if (newline > conn->in && newline[-1] == '\r')
+            newline[-1] = '\0';
+        run_command(conn, conn->in);
+
+        memmove(conn->in, conn->in + used, conn->in_len - used);
+        conn->in_len -= used;
+    }
+}
+
+// 송신 버퍼를 논블로킹으로 비운다 (연결이 끊겼으면 false)
+static bool flush_output(admin_conn_t *conn) {
+    while (conn->out_sent < conn->out_len) {
+        ssize_t n = send(conn->fd, conn->out + conn->out_sent, conn->out_len - conn->out_sent, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        conn->out_sent += (size_t)n;
+    }
+    conn->out_len  = 0;
+    conn->out_sent = 0;
+    return true;
+}
+
+static void set_events(int epfd, admin_conn_t *conn, uint32_t events) {
+    if (conn->events == events)
+        return;
+    struct epoll_event ev = {.events = events, .data.fd = conn->fd};
+    epoll_ctl(epfd, EPOLL_CTL_MOD, conn->fd, &ev);
+    conn->events = events;
+}
+
+// 이벤트 한 번 분량의 일: 명령 실행 또는 목록 일부 생성, 그리고 보낼 수 있는 만큼 전송
+// 할 일이 남았으면 EPOLLOUT을 걸어 두어 다음 루프 바퀴에서 이어 간다
+// 입력 버퍼가 실행 대기 중인 명령으로 차 있는 동안은 EPOLLIN을 내려 두고, 명령을 소비하면 다시 건다
+static void pump(int epfd, admin_conn_t *conn) {
+    if (conn->stream != ADMIN_STREAM_NONE)
+        continue_stream(conn);
+    else
+        run_pending_commands(conn);
+
+    if (conn->in_len >= sizeof(conn->in) - 1 && !memchr(conn->in, '\n', conn->in_len)) {
+        // 줄 바꿈 없이 버퍼를 채운 입력은 버린다
+        reply(conn, "ERR command too long\n");
+        conn->in_len = 0;
+    }
+
+    if (!flush_output(conn)) {
+        close_conn(epfd, conn);
+        return;
+    }
+
+    bool output_left  = conn->out_len > 0;
+    bool command_left = memchr(conn->in, '\n', conn->in_len) != NULL;
+    bool work_left    = output_left || conn->stream != ADMIN_STREAM_NONE || (command_left && !conn->closing);
+    bool input_full   = conn->in_len >= sizeof(conn->in) - 1;
+    if (conn->closing && !output_left) {
+        close_conn(epfd, conn);
+        return;
+    }
+    set_events(epfd, conn, (input_full ? 0 : EPOLLIN) | (work_left ? EPOLLOUT : 0));
+}
+
+void admin_server_handle(int epfd, int fd, uint32_t events) {
+    if (fd == g_admin.listener) {
+        accept_admins(epfd);
+        return;
+    }
+
+    admin_conn_t *conn = find_conn(fd);
+    if (!conn)
+        return;
+
+    if (events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+        // 버퍼가 실행 대기 중인 명령으로 차 있으면 목록 출력이 끝날 때까지 읽지 않는다 (HUP/ERR만 올 수 있다)
+        if (conn->in_len < sizeof(conn->in) - 1) {
+            ssize_t n = recv(fd, conn->in + conn->in_len, sizeof(conn->in) - 1 - conn->in_len, 0);
+            if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                LOG_INFO("Admin client disconnected: fd=%d", fd);
+                close_conn(epfd, conn);
+                return;
+            }
+            if (n > 0)
+                conn->in_len += (size_t)n;
+        }
+    }
+
+    pump(epfd, conn);
+}
+
+void admin_server_stop(void) {
+    for (int i = 0; i < ADMIN_MAX_CONNECTIONS; i++) {
+        if (g_admin.conns[i].fd >= 0) {
+            close(g_admin.conns[i].fd);
+            g_admin.conns[i].fd = -1;
+        }
+    }
+    if (g_admin.listener >= 0) {
+        close(g_admin.listener);
+        g_admin.listener = -1;
+        unlink(g_admin.path);
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef ADMIN_SERVER_H
+#define ADMIN_SERVER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// 관리용 Unix 도메인 소켓 (한 줄에 명령 하나, 게임 서버와 같은 이벤트 루프에서 처리)
+// 응답은 여러 줄이고 마지막 줄은 "OK ..." 또는 "ERR ..."로 시작한다
+
+// 명령행 인자에서 -a 소켓 경로를 파싱 (없으면 기본값, "none"이면 끔)
+const char *admin_parse_path_from_args(int argc, char *argv[]);
+
+// path에 리슨하고 epoll에 등록 (path가 NULL이거나 실패하면 -1, 게임 서버는 계속 동작)
+int admin_server_start(int epfd, const char *path);
+
+// fd가 관리 리스너나 관리 연결인지
+bool admin_server_owns(int fd);
+
+// 관리 fd의 epoll 이벤트 처리 (이벤트 루프 스레드 전용)
+void admin_server_handle(int epfd, int fd, uint32_t events);
+
+// 연결을 닫고 소켓 파일을 지운다
+void admin_server_stop(void);
+
+#endif  // ADMIN_SERVER_H
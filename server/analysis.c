@@ -0,0 +1,265 @@
+#include "analysis.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "clock.h"
+#include "config.h"
+#include "handlers/handlers.h"
+#include "logger.h"
+#include "rule.h"
+#include "search.h"
+#include "utils.h"
+#include "worker_pool.h"
+
+// 요청 간격을 기록하는 fd 범위 (기본 RLIMIT_NOFILE과 같음, 그 이상은 거절)
+#define ANALYSIS_MAX_CLIENT_FD 1024
+
+// 이 이상의 평가는 이미 승부가 난 국면으로 보고 손실 계산에서 잘라낸다
+#define ANALYSIS_SCORE_CLAMP 1000
+
+// 분석 작업 (이벤트 루프가 만들고, 워커가 채우고, done에서 해제)
+typedef struct {
+    int         fd;                           // 결과를 받을 클라이언트
+    atomic_bool cancelled;                    // 연결이 끊겨 결과가 필요 없어짐
+    char        game_id[GAME_ID_LENGTH + 1];  // 클라이언트가 보낸 게임 ID
+    size_t      n;                            // 분석할 반수
+    move_t      moves[DEFAULT_ANALYSIS_MAX_PLIES];
+
+    // 워커가 채운다: 국면 i (moves[i]를 두기 전, i == n은 마지막 국면)의 최선 수와 백 기준 평가
+    move_t best[DEFAULT_ANALYSIS_MAX_PLIES + 1];
+    int    score[DEFAULT_ANALYSIS_MAX_PLIES + 1];
+    int    depth;  // 시간 상한 때문에 가장 얕게 끝난 탐색 깊이
+    bool   ok;
+} analysis_job_t;
+
+// 클라이언트별 요청 상태
+typedef struct {
+    analysis_job_t *job;      // 대기/실행 중인 요청 (없으면 NULL)
+    int64_t         last_ms;  // 마지막으로 받아들인 요청 시각 (0이면 없음)
+} analysis_client_t;
+
+// 이벤트 루프 스레드에서만 접근하므로 잠금 없음
+static struct {
+    analysis_client_t clients[ANALYSIS_MAX_CLIENT_FD];
+    analysis_job_t   *queue[DEFAULT_ANALYSIS_QUEUE_SIZE];  // 워커 풀 제출을 기다리는 요청 (원형 큐)
+    int               queue_head;
+    int               queue_count;
+    int               inflight;  // 워커 풀에 넣은 분석 수
+} g_analysis;
+
+static inline int clamp_score(int score) {
+    if (score > ANALYSIS_SCORE_CLAMP)
+        return ANALYSIS_SCORE_CLAMP;
+    if (score < -ANALYSIS_SCORE_CLAMP)
+        return -ANALYSIS_SCORE_CLAMP;
+    return score;
+}
+
+// 워커 스레드: 시작 위치부터 수를 두며 국면마다 얕게 탐색
+// 치환표는 스레드별로 유지되므로 이어지는 국면의 탐색 결과를 다음 국면에서 재사용한다
+static void analysis_work(void *arg) {
+    analysis_job_t *job = arg;
+    tt_t           *tt  = tt_thread_local(DEFAULT_BOT_TT_SIZE_MB);
+    if (!tt) {
+        LOG_ERROR("Failed to allocate analysis transposition table");
+        return;
+    }
+
+    game_t             G;
+    position_history_t history;
+    init_startpos(&G);
+    position_history_attach(&G, &history);
+
+    search_limits_t limits = {.max_depth = DEFAULT_ANALYSIS_DEPTH, .time_ms = DEFAULT_ANALYSIS_PLY_TIME_MS};
+    job->depth             = DEFAULT_ANALYSIS_DEPTH;
+
+    for (size_t ply = 0; ply <= job->n; ply++) {
+        if (atomic_load_explicit(&job->cancelled, memory_order_relaxed))
+            return;
+
+        search_result_t r;
+        bool            found = search_best_move(&G, &limits, tt, &r);
+        job->best[ply]        = found ? r.best : MOVE_NONE;
+        job->score[ply]       = G.side_to_move == TEAM_WHITE ? r.score : -r.score;
+
+        // 합법 수가 하나뿐이거나 메이트를 찾아 일찍 멈춘 국면은 깊이 통계에서 뺀다
+        if (found && r.depth > 0 && r.depth < job->depth &&
+            r.score < SCORE_MATE_MIN && r.score > -SCORE_MATE_MIN)
+            job->depth = r.depth;
+
+        if (ply < job->n)
+            apply_move(&G, job->moves[ply]);
+    }
+    job->ok = true;
+}
+
+int send_analysis_failure(int fd, const char *game_id, const char *message) {
+    ServerMessage       msg  = SERVER_MESSAGE__INIT;
+    AnalyzeGameResponse resp = ANALYZE_GAME_RESPONSE__INIT;
+
+    resp.game_id = (char *)game_id;
+    resp.success = false;
+    resp.message = (char *)message;
+
+    msg.msg_case         = SERVER_MESSAGE__MSG_ANALYZE_GAME_RES;
+    msg.analyze_game_res = &resp;
+
+    return send_server_message(fd, &msg);
+}
+
+// 응답 한 칸 (MoveAnalysis와 그 문자열 버퍼를 함께 할당)
+typedef struct {
+    MoveAnalysis msg;
+    char         move[MOVE_STR_LEN];
+    char         best_move[MOVE_STR_LEN];
+} move_analysis_buf_t;
+
+// 수별 결과를 AnalyzeGameResponse로 만들어 전송
+static int send_analysis_result(const analysis_job_t *job) {
+    move_analysis_buf_t *items = calloc(job->n, sizeof(move_analysis_buf_t));
+    MoveAnalysis       **ptrs  = calloc(job->n, sizeof(MoveAnalysis *));
+    if (!items || !ptrs) {
+        log_perror("calloc");
+        free(items);
+        free(ptrs);
+        return send_analysis_failure(job->fd, job->game_id, "Out of memory");
+    }
+
+    int blunders = 0;
+    for (size_t i = 0; i < job->n; i++) {
+        MoveAnalysis *ma = &items[i].msg;
+        move_analysis__init(ma);
+        move_format(job->moves[i], items[i].move);
+        move_format(job->best[i], items[i].best_move);
+
+        ma->ply         = (int32_t)i;
+        ma->move        = items[i].move;
+        ma->best_move   = items[i].best_move;
+        ma->eval_before = job->score[i];
+        ma->eval_after  = job->score[i + 1];
+
+        // 둔 쪽 기준 손실 (시작 위치에서 출발하므로 짝수 반수가 백)
+        int sign    = (i % 2 == 0) ? 1 : -1;
+        int loss    = sign * (clamp_score(job->score[i]) - clamp_score(job->score[i + 1]));
+        ma->blunder = loss >= DEFAULT_ANALYSIS_BLUNDER_CP;
+        if (ma->blunder)
+            blunders++;
+
+        ptrs[i] = ma;
+    }
+
+    ServerMessage       msg  = SERVER_MESSAGE__INIT;
+    AnalyzeGameResponse resp = ANALYZE_GAME_RESPONSE__INIT;
+
+    resp.game_id = (char *)job->game_id;
+    resp.success = true;
+    resp.n_moves = job->n;
+    resp.moves   = ptrs;
+    resp.depth   = job->depth;
+
+    msg.msg_case         = SERVER_MESSAGE__MSG_ANALYZE_GAME_RES;
+    msg.analyze_game_res = &resp;
+
+    int result = send_server_message(job->fd, &msg);
+    LOG_INFO("Analysis sent to fd=%d for game %s (%zu plies, depth=%d, blunders=%d)",
+             job->fd, job->game_id, job->n, job->depth, blunders);
+
+    free(items);
+    free(ptrs);
+    return result;
+}
+
+static void analysis_done(void *arg);
+
+// 동시 실행 한도 안에서 대기 중인 요청을 워커 풀에 넣는다
+static void analysis_pump(void) {
+    while (g_analysis.inflight < DEFAULT_ANALYSIS_MAX_INFLIGHT && g_analysis.queue_count > 0) {
+        analysis_job_t *job   = g_analysis.queue[g_analysis.queue_head];
+        g_analysis.queue_head = (g_analysis.queue_head + 1) % DEFAULT_ANALYSIS_QUEUE_SIZE;
+        g_analysis.queue_count--;
+
+        if (atomic_load_explicit(&job->cancelled, memory_order_relaxed)) {
+            free(job);
+            continue;
+        }
+
+        if (worker_pool_submit(WORKER_KEY_NONE, analysis_work, analysis_done, job) < 0) {
+            LOG_ERROR("Failed to queue analysis for fd=%d", job->fd);
+            g_analysis.clients[job->fd].job = NULL;
+            send_analysis_failure(job->fd, job->game_id, "Server is busy, try again later");
+            free(job);
+            continue;
+        }
+        g_analysis.inflight++;
+    }
+}
+
+// 이벤트 루프 스레드: 결과 전송 후 다음 요청을 이어서 넣는다
+static void analysis_done(void *arg) {
+    analysis_job_t *job = arg;
+    g_analysis.inflight--;
+
+    if (atomic_load_explicit(&job->cancelled, memory_order_relaxed)) {
+        LOG_DEBUG("Discarding analysis for disconnected client (game %s)", job->game_id);
+    } else {
+        g_analysis.clients[job->fd].job = NULL;
+        if (job->ok)
+            send_analysis_result(job);
+        else
+            send_analysis_failure(job->fd, job->game_id, "Analysis failed");
+    }
+    free(job);
+
+    analysis_pump();
+}
+
+analysis_status_t analysis_request(int fd, const char *game_id, const move_t *moves, size_t n) {
+    if (fd < 0 || fd >= ANALYSIS_MAX_CLIENT_FD || n > DEFAULT_ANALYSIS_MAX_PLIES)
+        return ANALYSIS_BUSY;
+
+    analysis_client_t *client = &g_analysis.clients[fd];
+    int64_t            now    = clock_now_ms();
+    if (client->job || (client->last_ms != 0 && now - client->last_ms < DEFAULT_ANALYSIS_COOLDOWN_SEC * 1000))
+        return ANALYSIS_RATE_LIMITED;
+    if (g_analysis.queue_count >= DEFAULT_ANALYSIS_QUEUE_SIZE)
+        return ANALYSIS_BUSY;
+
+    analysis_job_t *job = calloc(1, sizeof(analysis_job_t));
+    if (!job) {
+        log_perror("calloc");
+        return ANALYSIS_FAILED;
+    }
+    job->fd = fd;
+    atomic_init(&job->cancelled, false);
+    snprintf(job->game_id, sizeof(job->game_id), "%s", game_id ? game_id : "");
+    job->n = n;
+    memcpy(job->moves, moves, n * sizeof(move_t));
+
+    client->job     = job;
+    client->last_ms = now;
+
+    int tail               = (g_analysis.queue_head + g_analysis.queue_count) % DEFAULT_ANALYSIS_QUEUE_SIZE;
+    g_analysis.queue[tail] = job;
+    g_analysis.queue_count++;
+
+    analysis_pump();
+    return ANALYSIS_QUEUED;
+}
+
+void analysis_forget_client(int fd) {
+    if (fd < 0 || fd >= ANALYSIS_MAX_CLIENT_FD)
+        return;
+
+    analysis_client_t *client = &g_analysis.clients[fd];
+    if (client->job) {
+        // 대기열/워커에 남은 작업은 done이나 pump에서 해제된다
+        atomic_store_explicit(&client->job->cancelled, true, memory_order_relaxed);
+        client->job = NULL;
+    }
+    client->last_ms = 0;
+}
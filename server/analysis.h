@@ -0,0 +1,26 @@
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+
+#include <stddef.h>
+
+#include "move.h"
+
+// analysis_request 결과
+typedef enum {
+    ANALYSIS_QUEUED = 0,    // 워커 풀에 넣었거나 차례를 기다리는 중
+    ANALYSIS_RATE_LIMITED,  // 같은 클라이언트의 요청이 진행 중이거나 너무 잦음
+    ANALYSIS_BUSY,          // 대기열이 가득 참
+    ANALYSIS_FAILED         // 메모리 부족 등
+} analysis_status_t;
+
+// 끝난 게임 분석 요청 (이벤트 루프 스레드 전용, moves는 validate_game을 통과한 수)
+// 국면마다 얕게 탐색해 수별 평가와 블런더 여부를 AnalyzeGameResponse로 fd에 보낸다
+analysis_status_t analysis_request(int fd, const char *game_id, const move_t *moves, size_t n);
+
+// 연결이 끊긴 클라이언트의 분석 결과를 버리고 요청 간격 기록을 지운다 (fd 재사용 대비)
+void analysis_forget_client(int fd);
+
+// 실패 응답 전송 (핸들러 공용)
+int send_analysis_failure(int fd, const char *game_id, const char *message);
+
+#endif  // ANALYSIS_H
@@ -0,0 +1,161 @@
+// book_build.c
+// 좌표 표기 기보 목록으로 오프닝 북 파일(book.h 형식)을 만드는 도구
+//
+// 입력은 한 줄에 한 갈래씩, 시작 위치부터 둔 수를 공백으로 구분해 적는다.
+// '#' 뒤는 주석이다. 여러 줄에 같은 국면/수가 나오면 가중치가 더해진다.
+//
+//   e2e4 e7e5 g1f3 b8c6 f1b5 a7a6   # 루이 로페즈
+//
+// 사용법:
+//   book_build <openings.txt> <book.bin>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "book.h"
+#include "legal_cache.h"
+#include "utils.h"
+
+#define BOOK_LINE_MAX 1024
+
+typedef struct {
+    book_entry_t *items;
+    size_t        count;
+    size_t        capacity;
+} entry_list_t;
+
+static int add_entry(entry_list_t *list, uint64_t key, move_t move) {
+    if (list->count == list->capacity) {
+        size_t        cap   = list->capacity ? list->capacity * 2 : 1024;
+        book_entry_t *items = realloc(list->items, cap * sizeof(book_entry_t));
+        if (!items)
+            return -1;
+        list->items    = items;
+        list->capacity = cap;
+    }
+    list->items[list->count++] = (book_entry_t){.key = key, .move = move, .weight = 1};
+    return 0;
+}
+
+// key, move 순으로 정렬해 같은 항목을 모은다
+static int cmp_key_move(const void *a, const void *b) {
+    const book_entry_t *x = a, *y = b;
+    if (x->key != y->key)
+        return x->key < y->key ? -1 : 1;
+    return (int)x->move - (int)y->move;
+}
+
+// 조회 순서: key 오름차순, 같은 key 안에서는 weight 내림차순
+static int cmp_key_weight(const void *a, const void *b) {
+    const book_entry_t *x = a, *y = b;
+    if (x->key != y->key)
+        return x->key < y->key ? -1 : 1;
+    return (int)y->weight - (int)x->weight;
+}
+
+// 한 줄을 시작 위치부터 재생하며 (국면, 수)를 추가, 잘못된 수가 있으면 -1
+static int add_line(entry_list_t *list, char *line, int lineno) {
+    char *comment = strchr(line, '#');
+    if (comment)
+        *comment = '\0';
+
+    game_t        G;
+    legal_cache_t cache;
+    init_startpos(&G);
+    legal_cache_reset(&cache);
+
+    int ply = 0;
+    for (char *tok = strtok(line, " \t\r\n"); tok; tok = strtok(NULL, " \t\r\n"), ply++) {
+        move_t parsed;
+        if (!move_parse(tok, &parsed)) {
+            fprintf(stderr, "line %d: invalid move notation '%s'\n", lineno, tok);
+            return -1;
+        }
+
+        // 생성기 플래그가 붙은 수로 저장해야 조회 시 합법 수와 그대로 비교할 수 있다
+        move_t move = legal_cache_find(legal_cache_get(&cache, &G), parsed);
+        if (move == MOVE_NONE) {
+            fprintf(stderr, "line %d: illegal move '%s' at ply %d\n", lineno, tok, ply);
+            return -1;
+        }
+        if (add_entry(list, G.hash, move) < 0) {
+            perror("realloc");
+            return -1;
+        }
+        apply_move(&G, move);
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <openings.txt> <book.bin>\n", argv[0]);
+        return 1;
+    }
+
+    FILE *in = fopen(argv[1], "r");
+    if (!in) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    entry_list_t list = {0};
+    char         line[BOOK_LINE_MAX];
+    int          lineno = 0, lines = 0;
+    while (fgets(line, sizeof(line), in)) {
+        lineno++;
+        size_t before = list.count;
+        if (add_line(&list, line, lineno) < 0) {
+            fclose(in);
+            free(list.items);
+            return 1;
+        }
+        if (list.count > before)
+            lines++;
+    }
+    fclose(in);
+
+    // 같은 (국면, 수)를 하나로 합치며 가중치를 더한다
+    qsort(list.items, list.count, sizeof(book_entry_t), cmp_key_move);
+    size_t unique = 0;
+    for (size_t i = 0; i < list.count; i++) {
+        if (unique > 0 && list.items[unique - 1].key == list.items[i].key &&
+            list.items[unique - 1].move == list.items[i].move) {
+            if (list.items[unique - 1].weight < UINT16_MAX)
+                list.items[unique - 1].weight++;
+        } else {
+            list.items[unique++] = list.items[i];
+        }
+    }
+    qsort(list.items, unique, sizeof(book_entry_t), cmp_key_weight);
+
+    game_t start;
+    init_startpos(&start);
+    book_header_t hdr = {
+        .magic      = BOOK_MAGIC,
+        .version    = BOOK_VERSION,
+        .count      = (uint32_t)unique,
+        .start_hash = start.hash,
+    };
+
+    FILE *out = fopen(argv[2], "wb");
+    if (!out) {
+        perror(argv[2]);
+        free(list.items);
+        return 1;
+    }
+    if (fwrite(&hdr, sizeof(hdr), 1, out) != 1 ||
+        fwrite(list.items, sizeof(book_entry_t), unique, out) != unique) {
+        perror("fwrite");
+        fclose(out);
+        free(list.items);
+        return 1;
+    }
+    fclose(out);
+    free(list.items);
+
+    printf("Opening book written: %s (%d lines, %zu entries, %zu bytes)\n",
+           argv[2], lines, unique, sizeof(hdr) + unique * sizeof(book_entry_t));
+    return 0;
+}
@@ -0,0 +1,225 @@
+#include "bot.h"
+
+#include <inttypes.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "book.h"
+#include "config.h"
+#include "handlers/handlers.h"
+#include "logger.h"
+#include "search.h"
+#include "worker_pool.h"
+
+// 봇 설정 전역 인스턴스
+bot_config_t g_bot_config = {
+    .match_delay_sec = DEFAULT_BOT_MATCH_DELAY,
+    .think_time_ms   = DEFAULT_BOT_THINK_TIME_MS,
+    .max_depth       = 0,
+    .book_path       = NULL,
+};
+
+// 오프닝 북 (시작 시 한 번 열고 읽기 전용으로 공유)
+static book_t g_book;
+
+// 탐색 작업 (요청 시점 국면의 복사본, 워커 풀에 넘겼다가 done에서 해제)
+typedef struct {
+    ActiveGame        *game;                         // 게임 슬롯 (재사용될 수 있으므로 game_id로 재확인)
+    char               game_id[GAME_ID_LENGTH + 1];  // 요청 시점 게임 ID
+    game_t             position;                     // 요청 시점 국면
+    position_history_t history;                      // 반복 판정용 기록 복사본
+    search_result_t    result;                       // 탐색 결과 (워커가 채움)
+    bool               found;                        // 둘 수 있는 수를 찾았는지
+    bool               from_book;                    // 오프닝 북에서 고른 수인지
+} bot_job_t;
+
+_Static_assert(MAX_ACTIVE_GAMES <= WORKER_POOL_MAX_KEYS, "game slot index is used as worker pool key");
+
+// 명령행 인자에서 봇 설정 파싱 (-b 매칭 대기 초, -t 탐색 밀리초)
+void bot_parse_args(int argc, char *argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            int delay = atoi(argv[i + 1]);
+            if (delay < 0) {
+                LOG_FATAL("Invalid bot match delay: %d", delay);
+                exit(EXIT_FAILURE);
+            }
+            g_bot_config.match_delay_sec = delay;
+            i++;
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            int think_ms = atoi(argv[i + 1]);
+            if (think_ms <= 0) {
+                LOG_FATAL("Invalid bot think time: %d", think_ms);
+                exit(EXIT_FAILURE);
+            }
+            g_bot_config.think_time_ms = think_ms;
+            i++;
+        } else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+            g_bot_config.book_path = argv[i + 1];
+            i++;
+        }
+    }
+    LOG_DEBUG("Bot config: match_delay=%ds, think_time=%dms",
+              g_bot_config.match_delay_sec, g_bot_config.think_time_ms);
+}
+
+void bot_open_book(void) {
+    char        exe_path[PATH_MAX];
+    const char *path = g_bot_config.book_path;
+
+    // 경로를 주지 않았으면 실행 파일과 같은 디렉터리에서 찾는다 (빌드 시 함께 생성됨)
+    if (!path) {
+        ssize_t len = readlink("/proc/self/exe", exe_path, sizeof(exe_path) - 1);
+        if (len <= 0)
+            return;
+        exe_path[len] = '\0';
+        char *slash   = strrchr(exe_path, '/');
+        if (!slash || (size_t)(slash - exe_path) + 1 + sizeof(DEFAULT_BOOK_FILE) > sizeof(exe_path))
+            return;
+        strcpy(slash + 1, DEFAULT_BOOK_FILE);
+        path = exe_path;
+    }
+
+    if (book_open(&g_book, path))
+        LOG_INFO("Opening book loaded: %s (%zu entries)", path, g_book.count);
+    else if (g_bot_config.book_path)
+        LOG_WARN("Failed to open opening book: %s", path);
+    else
+        LOG_INFO("No opening book at %s, bot searches from move one", path);
+}
+
+void bot_close_book(void) {
+    book_close(&g_book);
+}
+
+// 탐색을 못 했을 때 (메모리 부족 등) 첫 번째 합법 수라도 골라 게임이 멈추지 않게 한다
+static bool pick_fallback_move(bot_job_t *job) {
+    move_t moves[MAX_LEGAL_MOVES];
+    if (generate_legal_moves(&job->position, moves) == 0)
+        return false;
+    job->result = (search_result_t){.best = moves[0]};
+    return true;
+}
+
+// 워커 스레드: 탐색만 하고 게임 상태는 건드리지 않는다
+static void bot_search_work(void *arg) {
+    bot_job_t *job = arg;
+
+    // 북에 있는 국면이면 탐색 없이 바로 둔다
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    move_t book_move = book_pick(&g_book, &job->position, job->position.hash ^ (uint64_t)ts.tv_nsec);
+    if (book_move != MOVE_NONE) {
+        job->result    = (search_result_t){.best = book_move};
+        job->found     = true;
+        job->from_book = true;
+        return;
+    }
+
+    job->position.history = &job->history;
+
+    tt_t *tt = tt_thread_local(DEFAULT_BOT_TT_SIZE_MB);
+    if (!tt) {
+        LOG_ERROR("Failed to allocate bot transposition table, playing first legal move in game %s", job->game_id);
+        job->found = pick_fallback_move(job);
+        return;
+    }
+
+    search_limits_t limits = {.max_depth = g_bot_config.max_depth, .time_ms = g_bot_config.think_time_ms};
+    job->found             = search_best_move(&job->position, &limits, tt, &job->result);
+
+    // 합법 수가 있는데 탐색이 실패했다면 탐색 메모리를 못 잡은 것
+    if (!job->found && pick_fallback_move(job)) {
+        LOG_ERROR("Bot search failed, playing first legal move in game %s", job->game_id);
+        job->found = true;
+    }
+}
+
+// 이벤트 루프 스레드: 그 사이 게임이 끝났거나 국면이 바뀌었으면 버리고, 아니면 수를 적용
+static void bot_search_done(void *arg) {
+    bot_job_t  *job  = arg;
+    ActiveGame *game = job->game;
+
+    if (!job->found) {
+        LOG_WARN("Bot has no legal move in game %s", job->game_id);
+    } else if (!game->is_active ||
+               strcmp(game->game_id, job->game_id) != 0 ||
+               game->game_state.hash != job->position.hash ||
+               game->game_state.fullmove_number != job->position.fullmove_number) {
+        LOG_DEBUG("Discarding stale bot move for game %s", job->game_id);
+    } else {
+        char move_str[MOVE_STR_LEN];
+        move_format(job->result.best, move_str);
+        if (job->from_book)
+            LOG_INFO("Bot book move for game %s: %s", job->game_id, move_str);
+        else
+            LOG_INFO("Bot move for game %s: %s (depth=%d, score=%d, nodes=%" PRIu64 ")",
+                     job->game_id, move_str, job->result.depth, job->result.score, job->result.nodes);
+
+        commit_move(game, job->result.best, BOT_PLAYER_FD);
+    }
+    free(job);
+}
+
+// 봇 차례인 게임의 국면을 복사해 워커 풀에 넣는다 (게임 슬롯 단위로 직렬화)
+int bot_request_move(ActiveGame *game) {
+    bot_job_t *job = malloc(sizeof(bot_job_t));
+    if (!job) {
+        log_perror("malloc");
+        return -1;
+    }
+
+    match_manager_lock();
+    team_t bot_side = is_bot_fd(game->white_player_fd) ? TEAM_WHITE : TEAM_BLACK;
+    if (!game->is_active || game->game_state.side_to_move != bot_side) {
+        match_manager_unlock();
+        free(job);
+        return -1;
+    }
+    job->game = game;
+    strcpy(job->game_id, game->game_id);
+    job->position          = game->game_state;
+    job->history           = game->position_history;
+    job->position.history  = NULL;  // 워커가 자기 복사본을 가리키게 한다
+    job->found             = false;
+    job->from_book         = false;
+    game->bot_move_pending = false;
+    match_manager_unlock();
+
+    int key = (int)(game - g_match_manager.active_games);
+    if (worker_pool_submit(key, bot_search_work, bot_search_done, job) < 0) {
+        // 풀이 가득 찼으면 버리지 않고 다음 타이머 틱에 다시 넣는다
+        LOG_WARN("Worker pool full, retrying bot move for game %s on next timer tick", job->game_id);
+        match_manager_lock();
+        if (game->is_active && strcmp(game->game_id, job->game_id) == 0)
+            game->bot_move_pending = true;
+        match_manager_unlock();
+        free(job);
+        return -1;
+    }
+
+    LOG_DEBUG("Bot move requested for game %s", job->game_id);
+    return 0;
+}
+
+// bot_move_pending인 게임(봇 백 첫 수, 워커 풀에 넣지 못한 요청)의 봇 수 요청을 넣는다
+void bot_retry_pending_moves(void) {
+    ActiveGame *pending[MAX_ACTIVE_GAMES];
+    int         count = 0;
+
+    match_manager_lock();
+    for (int i = 0; i < MAX_ACTIVE_GAMES; i++) {
+        ActiveGame *game = &g_match_manager.active_games[i];
+        if (game->is_active && game->bot_move_pending)
+            pending[count++] = game;
+    }
+    match_manager_unlock();
+
+    for (int i = 0; i < count; i++)
+        bot_request_move(pending[i]);
+}
@@ -0,0 +1,30 @@
+#ifndef BOT_H
+#define BOT_H
+
+#include "match_manager.h"
+
+// 봇 설정 (명령행 인자로 덮어쓸 수 있음)
+typedef struct {
+    int         match_delay_sec;  // 대기 플레이어를 봇과 매칭하기까지의 시간 (0이면 끔)
+    int         think_time_ms;    // 수당 탐색 시간
+    int         max_depth;        // 최대 탐색 깊이 (0이면 시간 예산만 사용)
+    const char *book_path;        // 오프닝 북 경로 (NULL이면 실행 파일 옆의 DEFAULT_BOOK_FILE)
+} bot_config_t;
+
+extern bot_config_t g_bot_config;
+
+// -b <초> (봇 매칭 대기 시간), -t <밀리초> (봇 탐색 시간), -k <경로> (오프닝 북) 파싱
+void bot_parse_args(int argc, char *argv[]);
+
+// 오프닝 북을 한 번 열어 모든 워커가 공유 (없으면 처음부터 탐색)
+void bot_open_book(void);
+void bot_close_book(void);
+
+// 봇 차례인 게임의 현재 국면을 복사해 워커 풀에 넣는다 (즉시 반환)
+// 탐색이 끝나면 이벤트 루프에서 국면이 그대로인지 확인한 뒤 수를 적용한다
+int bot_request_move(ActiveGame *game);
+
+// bot_move_pending인 게임의 봇 수 요청을 넣는다 (타이머 스레드에서 틱마다 호출)
+void bot_retry_pending_moves(void);
+
+#endif  // BOT_H
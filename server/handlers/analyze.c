@@ -0,0 +1,61 @@
+#include <stdio.h>
+
+#include "../analysis.h"
+#include "config.h"
+#include "handlers.h"
+#include "logger.h"
+#include "rule.h"
+
+// 끝난 게임 분석 요청 처리 (수 목록 검증 후 분석 서비스에 넘긴다)
+int handle_analyze_game_message(int fd, ClientMessage *req) {
+    if (req->msg_case != CLIENT_MESSAGE__MSG_ANALYZE_GAME || !req->analyze_game) {
+        LOG_ERROR("Invalid message type for analyze handler: fd=%d, msg_case=%d", fd, req->msg_case);
+        return -1;
+    }
+
+    AnalyzeGameRequest *analyze_req = req->analyze_game;
+    const char         *game_id     = analyze_req->game_id ? analyze_req->game_id : "";
+    size_t              n           = analyze_req->n_moves;
+
+    LOG_INFO("Analysis requested by fd=%d for game %s (%zu plies)", fd, game_id, n);
+
+    if (n == 0 || n > DEFAULT_ANALYSIS_MAX_PLIES) {
+        return send_analysis_failure(fd, game_id, "Move list is empty or too long") < 0 ? -1 : 0;
+    }
+
+    // 좌표 표기 파싱 후 시작 위치부터 합법성 확인
+    move_t moves[DEFAULT_ANALYSIS_MAX_PLIES];
+    char   reason[64];
+    for (size_t i = 0; i < n; i++) {
+        if (!analyze_req->moves[i] || !move_parse(analyze_req->moves[i], &moves[i])) {
+            snprintf(reason, sizeof(reason), "Invalid move notation at ply %zu", i);
+            return send_analysis_failure(fd, game_id, reason) < 0 ? -1 : 0;
+        }
+    }
+
+    validate_result_t validation;
+    if (!validate_game(moves, n, &validation)) {
+        snprintf(reason, sizeof(reason), "Illegal move at ply %zu", validation.illegal_ply);
+        return send_analysis_failure(fd, game_id, reason) < 0 ? -1 : 0;
+    }
+
+    const char *message = NULL;
+    switch (analysis_request(fd, game_id, moves, n)) {
+        case ANALYSIS_QUEUED:
+            LOG_DEBUG("Analysis queued for fd=%d", fd);
+            return 0;
+        case ANALYSIS_RATE_LIMITED:
+            message = "Analysis already requested recently, try again later";
+            break;
+        case ANALYSIS_BUSY:
+            message = "Server is busy, try again later";
+            break;
+        case ANALYSIS_FAILED:
+        default:
+            message = "Failed to start analysis";
+            break;
+    }
+
+    LOG_WARN("Analysis request from fd=%d rejected: %s", fd, message);
+    return send_analysis_failure(fd, game_id, message) < 0 ? -1 : 0;
+}
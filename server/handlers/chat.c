@@ -35,14 +35,14 @@ int handle_chat_message(int fd, ClientMessage *req) {
     chat_broadcast.message   = chat_message;
     chat_broadcast.player_id = sender_id;
 
-    // 응답 전송
-    int result = send_server_message(game->white_player_fd, &resp);
+    // 응답 전송 (봇 쪽은 받을 소켓이 없다)
+    int result = is_bot_fd(game->white_player_fd) ? 0 : send_server_message(game->white_player_fd, &resp);
     if (result < 0) {
         LOG_ERROR("Failed to send chat response to fd=%d", game->white_player_fd);
         return -1;
     }
 
-    result = send_server_message(game->black_player_fd, &resp);
+    result = is_bot_fd(game->black_player_fd) ? 0 : send_server_message(game->black_player_fd, &resp);
     if (result < 0) {
         LOG_ERROR("Failed to send chat response to fd=%d", game->black_player_fd);
         return -1;
@@ -42,6 +42,10 @@ int dispatch_client_message(int fd, ClientMessage *msg) {
             LOG_DEBUG("Handling RESIGN message from fd=%d", fd);
             return handle_resign_message(fd, msg);
 
+        case CLIENT_MESSAGE__MSG_ANALYZE_GAME:
+            LOG_DEBUG("Handling ANALYZE_GAME message from fd=%d", fd);
+            return handle_analyze_game_message(fd, msg);
+
             // 나중에 추가될 메시지 타입들
             // case CLIENT_MESSAGE__MSG_JOIN_GAME:
             //     return handle_join_game_message(fd, msg);
@@ -1,7 +1,9 @@
 #ifndef HANDLERS_H
 #define HANDLERS_H
 
+#include "../match_manager.h"
 #include "message.pb-c.h"
+#include "move.h"
 
 // 핸들러에서 사용하는 함수들 (common/network.c에서 정의)
 int send_server_message(int fd, ServerMessage *msg);
@@ -19,9 +21,16 @@ int handle_echo_message(int fd, ClientMessage *req);
 int handle_match_game_message(int fd, ClientMessage *req);
 int handle_cancel_match_message(int fd, ClientMessage *req);
 int handle_chat_message(int fd, ClientMessage *req);
+int handle_analyze_game_message(int fd, ClientMessage *req);
 
 // 나중에 추가될 핸들러들
 int handle_move_message(int fd, ClientMessage *req);
 int handle_resign_message(int fd, ClientMessage *req);
 
+// 검증된 수 적용 + 응답/브로드캐스트/종료 판정 (handlers/move.c, 봇 워커 공용)
+int commit_move(ActiveGame *game, move_t move, int fd);
+
+// 게임 시작 알림 전송 (handlers/match.c, 봇 매칭 공용)
+int send_match_start(int fd, ActiveGame *game, Team assigned_team, const char *opponent_name);
+
 #endif  // HANDLERS_H
\ No newline at end of file
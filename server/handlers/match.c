@@ -7,6 +7,43 @@
 #include "handlers.h"
 #include "logger.h"
 
+// 게임 시작 알림 (팀, 상대 이름, 타이머 정보 포함)
+int send_match_start(int fd, ActiveGame *game, Team assigned_team, const char *opponent_name) {
+    ServerMessage     response   = SERVER_MESSAGE__INIT;
+    MatchGameResponse match_resp = MATCH_GAME_RESPONSE__INIT;
+
+    match_resp.success       = true;
+    match_resp.message       = "Match found! Game starting...";
+    match_resp.game_id       = game->game_id;
+    match_resp.assigned_team = assigned_team;
+    match_resp.opponent_name = opponent_name ? (char *)opponent_name : "";
+
+    // 타이머 정보 추가 (밀리초를 초로 변환해서 전송)
+    match_resp.time_limit_per_player = game->time_limit_per_player / 1000;
+    match_resp.white_time_remaining  = game->white_time_remaining / 1000;
+    match_resp.black_time_remaining  = game->black_time_remaining / 1000;
+
+    // 게임 시작 시간 설정
+    match_resp.game_start_time = malloc(sizeof(Google__Protobuf__Timestamp));
+    if (match_resp.game_start_time) {
+        google__protobuf__timestamp__init(match_resp.game_start_time);
+        match_resp.game_start_time->seconds = game->game_start_time;
+        match_resp.game_start_time->nanos   = 0;
+    }
+
+    response.msg_case       = SERVER_MESSAGE__MSG_MATCH_GAME_RES;
+    response.match_game_res = &match_resp;
+
+    int result = send_server_message(fd, &response);
+
+    // 메모리 해제
+    if (match_resp.game_start_time) {
+        free(match_resp.game_start_time);
+    }
+
+    return result;
+}
+
 // 매칭 요청 처리 핸들러
 int handle_match_game_message(int fd, ClientMessage *req) {
     if (!req->match_game) {
@@ -63,7 +100,7 @@ int handle_match_game_message(int fd, ClientMessage *req) {
 
             return send_server_message(fd, &response);
 
-        case MATCH_STATUS_GAME_STARTED:
+        case MATCH_STATUS_GAME_STARTED: {
             // 게임 시작 (두 플레이어 모두에게 알림)
             LOG_INFO("Match found! Game %s started for fd=%d", result.game_id, fd);
 
@@ -75,78 +112,19 @@ int handle_match_game_message(int fd, ClientMessage *req) {
             }
 
             // 현재 플레이어에게 응답
-            match_resp.success       = true;
-            match_resp.message       = "Match found! Game starting...";
-            match_resp.game_id       = result.game_id;
-            match_resp.assigned_team = result.assigned_team;
-            match_resp.opponent_name = result.opponent_name ? result.opponent_name : "";
-
-            // 타이머 정보 추가 (밀리초를 초로 변환해서 전송)
-            match_resp.time_limit_per_player = game->time_limit_per_player / 1000;
-            match_resp.white_time_remaining  = game->white_time_remaining / 1000;
-            match_resp.black_time_remaining  = game->black_time_remaining / 1000;
-
-            // 게임 시작 시간 설정
-            match_resp.game_start_time = malloc(sizeof(Google__Protobuf__Timestamp));
-            if (match_resp.game_start_time) {
-                google__protobuf__timestamp__init(match_resp.game_start_time);
-                match_resp.game_start_time->seconds = game->game_start_time;
-                match_resp.game_start_time->nanos   = 0;
-            }
-
-            response.msg_case       = SERVER_MESSAGE__MSG_MATCH_GAME_RES;
-            response.match_game_res = &match_resp;
+            int send_result = send_match_start(fd, game, result.assigned_team, result.opponent_name);
 
-            int send_result = send_server_message(fd, &response);
-
-            // 메모리 해제
-            if (match_resp.game_start_time) {
-                free(match_resp.game_start_time);
-                match_resp.game_start_time = NULL;
-            }
-
-            // 상대방에게도 게임 시작 알림 전송
+            // 상대방에게도 게임 시작 알림 전송 (상대방의 상대방 이름은 현재 플레이어 이름)
             if (send_result >= 0 && result.opponent_fd >= 0) {
-                // 상대방의 상대방 이름은 현재 플레이어 이름
-                char *current_player_name = NULL;
-                if (game) {
-                    current_player_name = (game->white_player_fd == fd) ? game->white_player_id : game->black_player_id;
-                }
-
-                MatchGameResponse opponent_resp = MATCH_GAME_RESPONSE__INIT;
-                opponent_resp.success           = true;
-                opponent_resp.message           = "Match found! Game starting...";
-                opponent_resp.game_id           = result.game_id;
-                opponent_resp.assigned_team     = (result.assigned_team == TEAM__TEAM_WHITE) ? TEAM__TEAM_BLACK : TEAM__TEAM_WHITE;
-                opponent_resp.opponent_name     = current_player_name ? current_player_name : "";
-
-                // 상대방에게도 타이머 정보 추가 (밀리초를 초로 변환해서 전송)
-                opponent_resp.time_limit_per_player = game->time_limit_per_player / 1000;
-                opponent_resp.white_time_remaining  = game->white_time_remaining / 1000;
-                opponent_resp.black_time_remaining  = game->black_time_remaining / 1000;
-
-                // 게임 시작 시간 설정 (상대방)
-                opponent_resp.game_start_time = malloc(sizeof(Google__Protobuf__Timestamp));
-                if (opponent_resp.game_start_time) {
-                    google__protobuf__timestamp__init(opponent_resp.game_start_time);
-                    opponent_resp.game_start_time->seconds = game->game_start_time;
-                    opponent_resp.game_start_time->nanos   = 0;
-                }
-
-                ServerMessage opponent_msg  = SERVER_MESSAGE__INIT;
-                opponent_msg.msg_case       = SERVER_MESSAGE__MSG_MATCH_GAME_RES;
-                opponent_msg.match_game_res = &opponent_resp;
+                char *current_player_name = (game->white_player_fd == fd) ? game->white_player_id : game->black_player_id;
+                Team  opponent_team       = (result.assigned_team == TEAM__TEAM_WHITE) ? TEAM__TEAM_BLACK : TEAM__TEAM_WHITE;
 
                 LOG_DEBUG("Sending game start notification to opponent (fd=%d)", result.opponent_fd);
-                send_server_message(result.opponent_fd, &opponent_msg);
-
-                // 메모리 해제
-                if (opponent_resp.game_start_time) {
-                    free(opponent_resp.game_start_time);
-                }
+                send_match_start(result.opponent_fd, game, opponent_team, current_player_name);
             }
 
             return send_result;
+        }
 
         case MATCH_STATUS_ERROR:
         default:
@@ -3,38 +3,18 @@
 #include <string.h>
 #include <time.h>
 
+#include "../bot.h"
 #include "../match_manager.h"
+#include "clock.h"
 #include "handlers.h"
+#include "legal_cache.h"
 #include "logger.h"
+#include "move.h"
+#include "protocol_utils.h"
 #include "rule.h"
+#include "trace.h"
 #include "utils.h"
 
-// 체스 좌표를 배열 인덱스로 변환 (예: "a1" -> (0, 0))
-bool parse_chess_coordinate(const char *coord, int *x, int *y) {
-    if (!coord || strlen(coord) != 2) {
-        return false;
-    }
-
-    char file = coord[0];  // a-h
-    char rank = coord[1];  // 1-8
-
-    if (file < 'a' || file > 'h' || rank < '1' || rank > '8') {
-        return false;
-    }
-
-    *x = file - 'a';  // 0-7
-    *y = rank - '1';  // 0-7
-
-    return true;
-}
-
-// 배열 인덱스를 체스 좌표로 변환 (예: (0, 0) -> "a1")
-void format_chess_coordinate(int x, int y, char *coord) {
-    coord[0] = 'a' + x;
-    coord[1] = '1' + y;
-    coord[2] = '\0';
-}
-
 // 헬퍼 함수: 에러 응답 전송
 int send_move_error(int fd, const char *game_id, const char *player_id, const char *error_msg) {
     ServerMessage response    = SERVER_MESSAGE__INIT;
@@ -69,19 +49,25 @@ int send_move_success(int fd, const char *game_id, const char *player_id, const
 }
 
 // 헬퍼 함수: 이동 브로드캐스트 (게임 상태 정보 포함)
-int broadcast_move_with_state(int fd, const char *game_id, const char *player_id,
-                              const char *from, const char *to,
+int broadcast_move_with_state(int fd, const char *game_id, const char *player_id, move_t move,
                               bool game_ends, Team winner_team, GameEndType end_type,
                               bool is_check, Team checked_team,
                               int32_t white_time_remaining, int32_t black_time_remaining) {
+    TRACE_BEGIN("broadcast");
     ServerMessage broadcast      = SERVER_MESSAGE__INIT;
     MoveBroadcast move_broadcast = MOVE_BROADCAST__INIT;
 
+    char from[3], to[3];
+    square_format(move_from_x(move), move_from_y(move), from);
+    square_format(move_to_x(move), move_to_y(move), to);
+
     move_broadcast.game_id      = (char *)game_id;
     move_broadcast.player_id    = (char *)player_id;
-    move_broadcast.from         = (char *)from;
-    move_broadcast.to           = (char *)to;
-    move_broadcast.promotion    = PIECE_TYPE__PT_NONE;  // TODO: 프로모션 처리
+    move_broadcast.from         = from;
+    move_broadcast.to           = to;
+    move_broadcast.promotion    = (move_flag(move) == MOVE_FLAG_PROMOTION)
+                                      ? piece_type_to_proto(move_promotion(move))
+                                      : PIECE_TYPE__PT_NONE;
     move_broadcast.game_ends    = game_ends;
     move_broadcast.winner_team  = winner_team;
     move_broadcast.end_type     = end_type;
@@ -96,8 +82,10 @@ int broadcast_move_with_state(int fd, const char *game_id, const char *player_id
     move_broadcast.move_timestamp = malloc(sizeof(Google__Protobuf__Timestamp));
     if (move_broadcast.move_timestamp) {
         google__protobuf__timestamp__init(move_broadcast.move_timestamp);
-        move_broadcast.move_timestamp->seconds = time(NULL);
-        move_broadcast.move_timestamp->nanos   = 0;
+        struct timespec now;
+        clock_wall_timespec(&now);
+        move_broadcast.move_timestamp->seconds = now.tv_sec;
+        move_broadcast.move_timestamp->nanos   = (int32_t)now.tv_nsec;
     }
 
     broadcast.msg_case       = SERVER_MESSAGE__MSG_MOVE_BROADCAST;
@@ -110,13 +98,13 @@ int broadcast_move_with_state(int fd, const char *game_id, const char *player_id
         free(move_broadcast.move_timestamp);
     }
 
+    TRACE_END("broadcast");
     return result;
 }
 
 // 헬퍼 함수: 이동 브로드캐스트 (하위 호환성을 위한 간단 버전)
-int broadcast_move(int fd, const char *game_id, const char *player_id,
-                   const char *from, const char *to) {
-    return broadcast_move_with_state(fd, game_id, player_id, from, to,
+int broadcast_move(int fd, const char *game_id, const char *player_id, move_t move) {
+    return broadcast_move_with_state(fd, game_id, player_id, move,
                                      false, TEAM__TEAM_UNSPECIFIED, GAME_END_TYPE__GAME_END_UNKNOWN,
                                      false, TEAM__TEAM_UNSPECIFIED, 0, 0);
 }
@@ -137,11 +125,11 @@ int send_game_end_broadcast(ActiveGame *game, const char *player_id, Team winner
 
     // 양쪽 플레이어 모두에게 게임 종료 브로드캐스트 전송
     int result = 0;
-    if (send_server_message(game->white_player_fd, &game_end_msg) < 0) {
+    if (!is_bot_fd(game->white_player_fd) && send_server_message(game->white_player_fd, &game_end_msg) < 0) {
         LOG_ERROR("Failed to send game end broadcast to white player fd=%d", game->white_player_fd);
         result = -1;
     }
-    if (send_server_message(game->black_player_fd, &game_end_msg) < 0) {
+    if (!is_bot_fd(game->black_player_fd) && send_server_message(game->black_player_fd, &game_end_msg) < 0) {
         LOG_ERROR("Failed to send game end broadcast to black player fd=%d", game->black_player_fd);
         result = -1;
     }
@@ -176,16 +164,13 @@ int handle_move_message(int fd, ClientMessage *req) {
 
     // 플레이어 ID 확인
     char *player_id   = NULL;
-    int   opponent_fd = -1;
     int   player_team = -1;
 
     if (game->white_player_fd == fd) {
         player_id   = game->white_player_id;
-        opponent_fd = game->black_player_fd;
         player_team = WHITE;
     } else if (game->black_player_fd == fd) {
         player_id   = game->black_player_id;
-        opponent_fd = game->white_player_fd;
         player_team = BLACK;
     } else {
         LOG_ERROR("Player fd=%d found in game but not as white or black player", fd);
@@ -198,38 +183,76 @@ int handle_move_message(int fd, ClientMessage *req) {
         return send_move_error(fd, game->game_id, player_id, "It's not your turn");
     }
 
-    // 체스 좌표 파싱
+    // 체스 좌표 파싱 (요청당 한 번만 파싱하고 이후에는 move_t로 다룬다)
     int from_x, from_y, to_x, to_y;
-    if (!parse_chess_coordinate(move_req->from, &from_x, &from_y)) {
+    if (!square_parse(move_req->from, &from_x, &from_y)) {
         LOG_WARN("Invalid 'from' coordinate: %s", move_req->from);
         return send_move_error(fd, game->game_id, player_id, "Invalid source coordinate");
     }
 
-    if (!parse_chess_coordinate(move_req->to, &to_x, &to_y)) {
+    if (!square_parse(move_req->to, &to_x, &to_y)) {
         LOG_WARN("Invalid 'to' coordinate: %s", move_req->to);
         return send_move_error(fd, game->game_id, player_id, "Invalid destination coordinate");
     }
 
-    // 이동 가능성 검증
-    // rule.c의 is_move_legal에서 sx=file(x), sy=rank(y)로 해석되므로
-    // 체스 좌표를 (file, rank) = (x, y) 순서로 전달
-    if (!is_move_legal(&game->game_state, from_x, from_y, to_x, to_y)) {
+    // 프로모션 기물 (지정하지 않으면 퀸)
+    piece_type_t promotion = PIECE_QUEEN;
+    if (move_req->promotion != PIECE_TYPE__PT_NONE) {
+        promotion = proto_to_piece_type(move_req->promotion);
+        if (promotion < PIECE_KNIGHT || promotion > PIECE_QUEEN) {
+            LOG_WARN("Invalid promotion piece from fd=%d: %d", fd, move_req->promotion);
+            return send_move_error(fd, game->game_id, player_id, "Invalid promotion piece");
+        }
+    }
+
+    // 폰이 마지막 랭크에 도달하는 수에만 프로모션 플래그를 붙인다
+    piecestate_t src  = game->game_state.board[from_y][from_x];
+    move_flag_t  flag = MOVE_FLAG_NORMAL;
+    if (!piece_is_empty(src) && piece_type(src) == PIECE_PAWN && (to_y == 0 || to_y == 7))
+        flag = MOVE_FLAG_PROMOTION;
+
+    move_t requested = move_make_flag(from_x, from_y, to_x, to_y, flag, promotion);
+
+    // 이동 가능성 검증 (현재 국면의 합법 수 캐시에서 조회)
+    TRACE_BEGIN("validate");
+    const legal_cache_t *legal = legal_cache_get(&game->legal_cache, &game->game_state);
+    move_t               move  = legal_cache_find(legal, requested);
+    TRACE_END("validate");
+    if (move == MOVE_NONE) {
         LOG_WARN("Illegal move from fd=%d: %s -> %s", fd, move_req->from, move_req->to);
         return send_move_error(fd, game->game_id, player_id, "Illegal move");
     }
 
-    // 이동 적용
-    // apply_move 함수도 동일한 좌표 순서 사용
-    apply_move(&game->game_state, from_x, from_y, to_x, to_y);
+    return commit_move(game, move, fd);
+}
+
+// 검증된 수를 적용하고 응답/브로드캐스트/종료 판정까지 처리
+// fd는 수를 둔 쪽 (봇이면 BOT_PLAYER_FD)
+int commit_move(ActiveGame *game, move_t move, int fd) {
+    const char *player_id   = (game->white_player_fd == fd) ? game->white_player_id : game->black_player_id;
+    int         opponent_fd = (game->white_player_fd == fd) ? game->black_player_fd : game->white_player_fd;
+
+    // 이동 적용 후 상대 차례 국면으로 캐시 갱신 (종료 판정과 다음 수 검증에 재사용)
+    TRACE_BEGIN("apply");
+    apply_move(&game->game_state, move);
+    legal_cache_fill(&game->legal_cache, &game->game_state);
+    TRACE_END("apply");
 
-    LOG_INFO("Move applied successfully for fd=%d: %s -> %s", fd, move_req->from, move_req->to);
+    // 응답용 FEN (이동 직후 국면)
+    char fen[FEN_MAX_LEN];
+    fen_write(&game->game_state, fen);
+
+    char move_str[MOVE_STR_LEN];
+    move_format(move, move_str);
+    LOG_INFO("Move applied successfully for fd=%d: %s", fd, move_str);
+    LOG_DEBUG("Position after move: %s", fen);
 
     // 타이머 업데이트 - 밀리초 단위로 정밀하게 관리
     // 타이머 스레드가 시간 차감을 담당하므로 여기서는 시간 기록만 업데이트
     extern MatchManager g_match_manager;
     extern int64_t      get_current_time_ms(void);  // 함수 선언
 
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
 
     // 다음 턴을 위해 마지막 이동 시간만 업데이트 (밀리초 단위)
     // 시간 차감은 타이머 스레드가 지속적으로 처리하고 있음
@@ -238,25 +261,20 @@ int handle_move_message(int fd, ClientMessage *req) {
     // last_timer_check_ms는 타이머 스레드에서만 업데이트하도록 함
     // 이렇게 하면 타이머 스레드가 정확한 경과 시간을 계산할 수 있음
 
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
 
     LOG_DEBUG("Timer updated for game %s: white=%d, black=%d",
               game->game_id, game->white_time_remaining, game->black_time_remaining);
 
-    // TODO: FEN 문자열 생성 (현재는 간단한 메시지로 대체)
-    char fen_placeholder[256];
-    snprintf(fen_placeholder, sizeof(fen_placeholder), "move_%d_to_%d",
-             game->game_state.halfmove_clock, game->game_state.side_to_move);
-
-    // 성공 응답 전송
-    if (send_move_success(fd, game->game_id, player_id, fen_placeholder) < 0) {
+    // 성공 응답 전송 (봇은 응답을 받을 소켓이 없다)
+    if (!is_bot_fd(fd) && send_move_success(fd, game->game_id, player_id, fen) < 0) {
         LOG_ERROR("Failed to send move success response to fd=%d", fd);
         return -1;
     }
 
     // 게임 상태 확인 (체크, 체크메이트, 스테일메이트 등)
     team_t      current_side       = game->game_state.side_to_move;  // 이동 후 현재 턴 (상대방)
-    bool        is_check_situation = is_in_check(&game->game_state, current_side);
+    bool        is_check_situation = game->legal_cache.in_check;
     bool        game_ends          = false;
     Team        winner_team        = TEAM__TEAM_UNSPECIFIED;
     GameEndType end_type           = GAME_END_TYPE__GAME_END_UNKNOWN;
@@ -269,12 +287,13 @@ int handle_move_message(int fd, ClientMessage *req) {
     }
 
     // 게임 종료 조건 확인 (시간 초과는 타이머 스레드에서 처리)
-    if (is_checkmate(&game->game_state)) {
+    TRACE_BEGIN("end_check");
+    if (legal_cache_is_checkmate(&game->legal_cache)) {
         LOG_INFO("Game %s ended by checkmate", game->game_id);
         game_ends   = true;
         winner_team = (current_side == TEAM_WHITE) ? TEAM__TEAM_BLACK : TEAM__TEAM_WHITE;
         end_type    = GAME_END_TYPE__GAME_END_CHECKMATE;
-    } else if (is_stalemate(&game->game_state)) {
+    } else if (legal_cache_is_stalemate(&game->legal_cache)) {
         LOG_INFO("Game %s ended by stalemate", game->game_id);
         game_ends   = true;
         winner_team = TEAM__TEAM_UNSPECIFIED;
@@ -284,12 +303,23 @@ int handle_move_message(int fd, ClientMessage *req) {
         game_ends   = true;
         winner_team = TEAM__TEAM_UNSPECIFIED;
         end_type    = GAME_END_TYPE__GAME_END_DRAW;
+    } else if (is_threefold_repetition(&game->game_state)) {
+        LOG_INFO("Game %s ended by threefold repetition", game->game_id);
+        game_ends   = true;
+        winner_team = TEAM__TEAM_UNSPECIFIED;
+        end_type    = GAME_END_TYPE__GAME_END_DRAW;
+    } else if (is_insufficient_material(&game->game_state)) {
+        LOG_INFO("Game %s ended by insufficient material", game->game_id);
+        game_ends   = true;
+        winner_team = TEAM__TEAM_UNSPECIFIED;
+        end_type    = GAME_END_TYPE__GAME_END_DRAW;
     }
+    TRACE_END("end_check");
 
     // 상대방에게 이동 브로드캐스트 (게임 상태 정보 포함)
     // 밀리초를 초 단위로 변환해서 전송 (클라이언트 호환성 유지)
-    if (broadcast_move_with_state(opponent_fd, game->game_id, player_id,
-                                  move_req->from, move_req->to,
+    if (!is_bot_fd(opponent_fd) &&
+        broadcast_move_with_state(opponent_fd, game->game_id, player_id, move,
                                   game_ends, winner_team, end_type,
                                   is_check_situation, checked_team,
                                   game->white_time_remaining / 1000, game->black_time_remaining / 1000) < 0) {
@@ -299,8 +329,8 @@ int handle_move_message(int fd, ClientMessage *req) {
 
     // 요청자에게도 이동 브로드캐스트 (게임 상태 정보 포함)
     // 밀리초를 초 단위로 변환해서 전송 (클라이언트 호환성 유지)
-    if (broadcast_move_with_state(fd, game->game_id, player_id,
-                                  move_req->from, move_req->to,
+    if (!is_bot_fd(fd) &&
+        broadcast_move_with_state(fd, game->game_id, player_id, move,
                                   game_ends, winner_team, end_type,
                                   is_check_situation, checked_team,
                                   game->white_time_remaining / 1000, game->black_time_remaining / 1000) < 0) {
@@ -311,7 +341,12 @@ int handle_move_message(int fd, ClientMessage *req) {
     // 게임이 종료된 경우 매치 매니저에서 제거
     if (game_ends) {
         remove_game(game->game_id);
+        return 0;
     }
 
+    // 봇 차례면 워커 풀에 다음 수 탐색을 맡긴다 (이벤트 루프는 기다리지 않음)
+    if (is_bot_fd(opponent_fd))
+        bot_request_move(game);
+
     return 0;
 }
\ No newline at end of file
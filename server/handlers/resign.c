@@ -21,7 +21,7 @@ int handle_resign_message(int fd, ClientMessage *req) {
              resign_req->player_id ? resign_req->player_id : "unknown", fd);
 
     // 매치 매니저에서 해당 플레이어가 참여한 게임 찾기
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
 
     ActiveGame *game                   = NULL;
     Team        winner_team            = TEAM__TEAM_UNSPECIFIED;
@@ -52,7 +52,7 @@ int handle_resign_message(int fd, ClientMessage *req) {
     }
 
     if (!game) {
-        pthread_mutex_unlock(&g_match_manager.mutex);
+        match_manager_unlock();
         LOG_WARN("Player %s (fd=%d) tried to resign but is not in any active game",
                  resign_req->player_id ? resign_req->player_id : "unknown", fd);
         return send_error_response(fd, 404, "You are not in any active game");
@@ -101,7 +101,7 @@ int handle_resign_message(int fd, ClientMessage *req) {
     game->is_active = false;
     g_match_manager.active_game_count--;
 
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
 
     LOG_INFO("Game %s ended due to resignation by %s", game_id, resign_req->player_id);
 
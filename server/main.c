@@ -1,42 +1,98 @@
 #include <signal.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
+#include "admin_server.h"
+#include "bot.h"
+#include "capture.h"
 #include "logger.h"
+#include "config.h"
 #include "match_manager.h"
+#include "metrics.h"
+#include "metrics_server.h"
 #include "server_network.h"
+#include "trace.h"
+#include "worker_pool.h"
 
-// 전역 변수로 epfd와 listener 저장 (시그널 핸들러에서 사용)
+// 전역 변수로 epfd와 listener 저장
 static int g_epfd     = -1;
 static int g_listener = -1;
 
-// 시그널 핸들러: 서버 종료 시 정리 작업
+// 시그널 핸들러: 이벤트 루프에 종료를 알리기만 한다
+// (요약 기록, 트레이스 내보내기, 정리는 이벤트 루프가 끝난 뒤 main에서 한다)
 void cleanup_signal_handler(int signum) {
-    // 시그널 핸들러에서는 async-signal-safe 함수만 사용
-    write(STDOUT_FILENO, "Received shutdown signal, cleaning up...\n", 41);
+    (void)signum;
+    server_request_stop();
+}
 
-    // 매칭 매니저 정리
-    cleanup_match_manager();
+// 명령행 인자에서 로그 레벨 파싱 (-l debug|info|warn|error|fatal)
+static void parse_log_level_from_args(int argc, char *argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+            int level = logger_parse_level(argv[i + 1]);
+            if (level < 0) {
+                LOG_FATAL("Invalid log level: %s", argv[i + 1]);
+                exit(EXIT_FAILURE);
+            }
+            logger_set_level((log_level_t)level);
+            i++;
+        }
+    }
+}
+
+// 명령행 인자에서 트레이싱 표본 비율 파싱 (-T N: 스레드마다 N번째 요청마다 하나, 0이면 끔)
+static void parse_trace_rate_from_args(int argc, char *argv[]) {
+    trace_set_sample_rate(DEFAULT_TRACE_SAMPLE_RATE);
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-T") == 0 && i + 1 < argc) {
+            int rate = atoi(argv[i + 1]);
+            if (rate < 0) {
+                LOG_FATAL("Invalid trace sample rate: %d", rate);
+                exit(EXIT_FAILURE);
+            }
+            trace_set_sample_rate((unsigned)rate);
+            i++;
+        }
+    }
+    LOG_DEBUG("Trace sample rate: 1/%u", trace_get_sample_rate());
+}
 
-    // 네트워크 리소스 정리
-    if (g_listener >= 0)
-        close(g_listener);
-    if (g_epfd >= 0)
-        close(g_epfd);
+// 명령행 인자에서 트래픽 캡처 경로 파싱 (-C <path>, 없으면 캡처하지 않음)
+static const char *parse_capture_path_from_args(int argc, char *argv[]) {
+    const char *path = NULL;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-C") == 0 && i + 1 < argc) {
+            path = argv[i + 1];
+            i++;
+        }
+    }
+    return path;
+}
 
-    write(STDOUT_FILENO, "Server shutdown complete\n", 25);
-    logger_cleanup();
-    _exit(0);  // exit() 대신 _exit() 사용 (async-signal-safe)
+// -L: 콘솔 대신 logs/server_<pid>.blog에 바이너리 로그 기록 (logdecode로 해석)
+static bool binary_log_requested(int argc, char *argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-L") == 0)
+            return true;
+    }
+    return false;
 }
 
 int main(int argc, char *argv[]) {
-    // 로거 초기화 (다른 초기화보다 먼저) - 콘솔 출력 모드
-    if (logger_init(LOG_OUTPUT_CONSOLE, NULL) != 0) {
+    // 로거 초기화 (다른 초기화보다 먼저) - 콘솔 출력 모드, -L이면 바이너리 파일
+    log_output_type_t log_output = binary_log_requested(argc, argv) ? LOG_OUTPUT_BINARY : LOG_OUTPUT_CONSOLE;
+    if (logger_init(log_output, "server") != 0) {
         fprintf(stderr, "Failed to initialize logger\n");
         return 1;
     }
 
+    // 다른 설정 로그보다 먼저 레벨을 적용한다
+    parse_log_level_from_args(argc, argv);
+    parse_trace_rate_from_args(argc, argv);
+
     LOG_INFO("Chess server starting... (PID: %d)", getpid());
 
     // 시그널 핸들러 등록
@@ -44,6 +100,9 @@ int main(int argc, char *argv[]) {
     signal(SIGTERM, cleanup_signal_handler);
     LOG_DEBUG("Signal handlers registered");
 
+    // 봇 설정은 매칭 매니저의 타이머 스레드가 읽으므로 먼저 파싱
+    bot_parse_args(argc, argv);
+
     // 매칭 매니저 초기화
     if (init_match_manager() < 0) {
         LOG_FATAL("Failed to initialize match manager");
@@ -51,6 +110,17 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
+    // 오프닝 북은 워커들이 공유하므로 워커 풀보다 먼저 연다
+    bot_open_book();
+
+    // 워커 풀 시작 (봇 탐색 등 무거운 작업은 이벤트 루프 밖에서 실행)
+    if (worker_pool_init(DEFAULT_WORKER_THREADS, DEFAULT_WORKER_QUEUE_CAPACITY) < 0) {
+        LOG_FATAL("Failed to start worker pool");
+        cleanup_match_manager();
+        logger_cleanup();
+        return 1;
+    }
+
     int port = parse_port_from_args(argc, argv);
     LOG_INFO("Parsed port: %d", port);
 
@@ -60,12 +130,34 @@ int main(int argc, char *argv[]) {
     g_epfd = setup_epoll(g_listener);
     LOG_INFO("Epoll instance created and listener registered");
 
+    // 워커 완료 알림은 같은 이벤트 루프에서 처리
+    register_event_fd(g_epfd, worker_pool_event_fd());
+
+    // 종료 시그널도 같은 이벤트 루프로 받는다
+    setup_stop_event(g_epfd);
+
+    // 메트릭 엔드포인트도 같은 이벤트 루프에서 처리 (실패해도 게임 서버는 계속 동작)
+    metrics_server_start(g_epfd, metrics_parse_port_from_args(argc, argv));
+
+    // 관리 소켓도 같은 이벤트 루프에서 처리 (게임 목록, FEN 덤프, 로그 레벨, 종료 대기, 강제 종료)
+    admin_server_start(g_epfd, admin_parse_path_from_args(argc, argv));
+
+    // 받은 프레임을 그대로 파일에 남긴다 (capreplay로 다시 보낼 수 있다)
+    capture_start(parse_capture_path_from_args(argc, argv));
+
     LOG_INFO("Chess server started successfully (port: %d)", port);
     LOG_INFO("Match manager initialized - ready for connections");
 
     event_loop(g_listener, g_epfd);
 
-    // 정상 종료 시에도 정리 작업 수행
+    // 정상 종료 시에도 정리 작업 수행 (디스패치 지연 요약을 먼저 남긴다)
+    metrics_log_dispatch_latency();
+    trace_write_file("server");
+    capture_stop();
+    admin_server_stop();
+    metrics_server_stop();
+    worker_pool_shutdown();
+    bot_close_book();
     cleanup_match_manager();
     cleanup(g_listener, g_epfd);
     logger_cleanup();
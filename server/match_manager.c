@@ -4,11 +4,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/time.h>  // gettimeofday를 위해 추가
 #include <unistd.h>
 
+#include "bot.h"
+#include "clock.h"
 #include "config.h"
+#include "handlers/handlers.h"
 #include "logger.h"
+#include "metrics.h"
 #include "network.h"
 #include "utils.h"  // 체스판 초기화를 위해 추가
 
@@ -19,11 +22,9 @@ pthread_t timer_thread_id      = 0;
 // 매칭 매니저 전역 인스턴스
 MatchManager g_match_manager;
 
-// 밀리초 단위 현재 시간 가져오기
+// 밀리초 단위 현재 시간 가져오기 (경과 시간 계산용 단조 시계, 이벤트 루프/타이머 틱마다 갱신된 값)
 int64_t get_current_time_ms(void) {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    return (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+    return clock_now_ms();
 }
 
 // 매칭 매니저 초기화
@@ -54,7 +55,7 @@ void cleanup_match_manager(void) {
     // 타이머 스레드 먼저 종료
     stop_timer_thread();
 
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
 
     // 대기 중인 플레이어들 정리
     memset(g_match_manager.waiting_players, 0, sizeof(g_match_manager.waiting_players));
@@ -64,7 +65,7 @@ void cleanup_match_manager(void) {
     memset(g_match_manager.active_games, 0, sizeof(g_match_manager.active_games));
     g_match_manager.active_game_count = 0;
 
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
     pthread_mutex_destroy(&g_match_manager.mutex);
 
     LOG_INFO("Match manager cleaned up");
@@ -102,8 +103,17 @@ void *timer_check_thread(void *arg) {
     LOG_INFO("Timer check thread started");
 
     while (timer_thread_running) {
+        // 이번 틱의 시각을 한 번만 읽고 아래에서는 캐시된 값을 쓴다
+        clock_tick();
         check_game_timeouts();
 
+        // 오래 기다린 플레이어는 봇과 매칭
+        if (g_bot_config.match_delay_sec > 0)
+            match_waiting_players_with_bot(g_bot_config.match_delay_sec);
+
+        // 방금 시작한 봇 백 게임의 첫 수와 워커 풀이 가득 차 밀린 봇 수 요청을 넣는다
+        bot_retry_pending_moves();
+
         // 100ms마다 체크 (더 정밀한 타이머)
         usleep(100000);  // 100ms = 100,000 microseconds
     }
@@ -116,7 +126,7 @@ void *timer_check_thread(void *arg) {
 void check_game_timeouts(void) {
     int64_t current_time_ms = get_current_time_ms();
 
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
 
     for (int i = 0; i < MAX_ACTIVE_GAMES; i++) {
         ActiveGame *game = &g_match_manager.active_games[i];
@@ -168,6 +178,7 @@ void check_game_timeouts(void) {
         game->last_timer_check_ms = current_time_ms;
 
         if (timeout_occurred) {
+            metric_inc(&g_metrics.timeouts);
             LOG_INFO("Game %s ended by timeout - winner: %s",
                      game->game_id,
                      (timeout_winner == TEAM__TEAM_WHITE) ? "WHITE" : "BLACK");
@@ -181,7 +192,7 @@ void check_game_timeouts(void) {
         }
     }
 
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
 }
 
 // 시간 초과로 인한 게임 종료 브로드캐스트 전송
@@ -199,11 +210,11 @@ int send_timeout_game_end_broadcast(ActiveGame *game, const char *timeout_player
 
     // 양쪽 플레이어 모두에게 게임 종료 브로드캐스트 전송
     int result = 0;
-    if (send_server_message(game->white_player_fd, &game_end_msg) < 0) {
+    if (!is_bot_fd(game->white_player_fd) && send_server_message(game->white_player_fd, &game_end_msg) < 0) {
         LOG_ERROR("Failed to send timeout game end broadcast to white player fd=%d", game->white_player_fd);
         result = -1;
     }
-    if (send_server_message(game->black_player_fd, &game_end_msg) < 0) {
+    if (!is_bot_fd(game->black_player_fd) && send_server_message(game->black_player_fd, &game_end_msg) < 0) {
         LOG_ERROR("Failed to send timeout game end broadcast to black player fd=%d", game->black_player_fd);
         result = -1;
     }
@@ -220,12 +231,34 @@ char *generate_game_id(void) {
     static int  counter = 1;
 
     // 간단한 게임 ID 생성 (타임스탬프 + 카운터)
-    snprintf(game_id, sizeof(game_id), "game_%ld_%d", time(NULL) % 100000, counter++);
+    snprintf(game_id, sizeof(game_id), "game_%ld_%d", clock_wall_sec() % 100000, counter++);
 
     LOG_DEBUG("Generated game ID: %s", game_id);
     return game_id;
 }
 
+// 새 게임 슬롯 초기화 (게임 ID, 표준 시작 위치, 타이머) - mutex를 잡은 상태에서 호출
+static void init_active_game(ActiveGame *game) {
+    // 게임 정보 설정
+    strcpy(game->game_id, generate_game_id());
+    game->game_start_time  = clock_wall_sec();
+    game->is_active        = true;
+    game->vs_bot           = false;
+    game->bot_move_pending = false;
+
+    // 체스판 초기화 (표준 시작 위치)
+    init_startpos(&game->game_state);
+    position_history_attach(&game->game_state, &game->position_history);
+    legal_cache_fill(&game->legal_cache, &game->game_state);
+
+    // 타이머 설정 (밀리초 단위)
+    game->time_limit_per_player = DEFAULT_GAME_TIME_LIMIT * 1000;  // 초를 밀리초로 변환
+    game->white_time_remaining  = DEFAULT_GAME_TIME_LIMIT * 1000;  // 초를 밀리초로 변환
+    game->black_time_remaining  = DEFAULT_GAME_TIME_LIMIT * 1000;  // 초를 밀리초로 변환
+    game->last_move_time_ms     = get_current_time_ms();
+    game->last_timer_check_ms   = game->last_move_time_ms;
+}
+
 // 플레이어를 매칭에 추가
 MatchResult add_player_to_matching(int fd, const char *player_id) {
     MatchResult result = {MATCH_STATUS_ERROR, NULL, TEAM__TEAM_UNSPECIFIED, -1, NULL, "Unknown error"};
@@ -236,7 +269,15 @@ MatchResult add_player_to_matching(int fd, const char *player_id) {
         return result;
     }
 
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
+
+    // 종료 대기 중에는 새 게임을 만들지 않는다
+    if (g_match_manager.draining) {
+        result.error_message = "Server is shutting down";
+        LOG_INFO("Rejecting match request from %s(fd=%d): server is draining", player_id, fd);
+        match_manager_unlock();
+        return result;
+    }
 
     // 이미 대기 중인 플레이어가 있는지 확인
     for (int i = 0; i < MAX_WAITING_PLAYERS; i++) {
@@ -251,22 +292,10 @@ MatchResult add_player_to_matching(int fd, const char *player_id) {
                     ActiveGame *game = &g_match_manager.active_games[j];
 
                     // 색상 랜덤 배정 (간단하게 시간 기반)
-                    bool current_is_white = (time(NULL) % 2 == 0);
+                    bool current_is_white = (clock_wall_sec() % 2 == 0);
 
-                    // 게임 정보 설정
-                    strcpy(game->game_id, generate_game_id());
-                    game->game_start_time = time(NULL);
-                    game->is_active       = true;
-
-                    // 체스판 초기화 (표준 시작 위치)
-                    init_startpos(&game->game_state);
-
-                    // 타이머 설정 (밀리초 단위)
-                    game->time_limit_per_player = DEFAULT_GAME_TIME_LIMIT * 1000;  // 초를 밀리초로 변환
-                    game->white_time_remaining  = DEFAULT_GAME_TIME_LIMIT * 1000;  // 초를 밀리초로 변환
-                    game->black_time_remaining  = DEFAULT_GAME_TIME_LIMIT * 1000;  // 초를 밀리초로 변환
-                    game->last_move_time_ms     = get_current_time_ms();
-                    game->last_timer_check_ms   = get_current_time_ms();
+                    // 게임 정보, 체스판, 타이머 초기화
+                    init_active_game(game);
 
                     if (current_is_white) {
                         game->white_player_fd = fd;
@@ -301,7 +330,7 @@ MatchResult add_player_to_matching(int fd, const char *player_id) {
                              game->white_player_id, game->white_player_fd,
                              game->black_player_id, game->black_player_fd);
 
-                    pthread_mutex_unlock(&g_match_manager.mutex);
+                    match_manager_unlock();
                     return result;
                 }
             }
@@ -309,7 +338,7 @@ MatchResult add_player_to_matching(int fd, const char *player_id) {
             // 게임 슬롯이 부족함
             result.error_message = "No available game slots";
             LOG_WARN("No available game slots for matching");
-            pthread_mutex_unlock(&g_match_manager.mutex);
+            match_manager_unlock();
             return result;
         }
     }
@@ -320,7 +349,7 @@ MatchResult add_player_to_matching(int fd, const char *player_id) {
             WaitingPlayer *player = &g_match_manager.waiting_players[i];
             player->fd            = fd;
             strcpy(player->player_id, player_id);
-            player->wait_start_time = time(NULL);
+            player->wait_start_time = clock_wall_sec();
             player->is_active       = true;
             g_match_manager.waiting_count++;
 
@@ -332,20 +361,20 @@ MatchResult add_player_to_matching(int fd, const char *player_id) {
 
             LOG_INFO("Player %s(fd=%d) added to waiting queue", player_id, fd);
 
-            pthread_mutex_unlock(&g_match_manager.mutex);
+            match_manager_unlock();
             return result;
         }
     }
 
     result.error_message = "Matching queue is full";
     LOG_WARN("Matching queue is full, cannot add player %s(fd=%d)", player_id, fd);
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
     return result;
 }
 
 // 플레이어를 매칭에서 제거
 int remove_player_from_matching(int fd) {
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
 
     // 대기 목록에서 제거
     for (int i = 0; i < MAX_WAITING_PLAYERS; i++) {
@@ -354,30 +383,30 @@ int remove_player_from_matching(int fd) {
             g_match_manager.waiting_players[i].is_active = false;
             g_match_manager.waiting_count--;
             LOG_INFO("Player removed from waiting queue (fd=%d)", fd);
-            pthread_mutex_unlock(&g_match_manager.mutex);
+            match_manager_unlock();
             return 0;
         }
     }
 
     LOG_DEBUG("Player not found in waiting queue (fd=%d)", fd);
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
     return -1;  // 플레이어를 찾지 못함
 }
 
 // 플레이어가 참여 중인 게임 찾기
 ActiveGame *find_game_by_player_fd(int fd) {
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
 
     for (int i = 0; i < MAX_ACTIVE_GAMES; i++) {
         if (g_match_manager.active_games[i].is_active &&
             (g_match_manager.active_games[i].white_player_fd == fd ||
              g_match_manager.active_games[i].black_player_fd == fd)) {
-            pthread_mutex_unlock(&g_match_manager.mutex);
+            match_manager_unlock();
             return &g_match_manager.active_games[i];
         }
     }
 
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
     return NULL;
 }
 
@@ -386,7 +415,7 @@ int remove_game(const char *game_id) {
     if (!game_id)
         return -1;
 
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
 
     for (int i = 0; i < MAX_ACTIVE_GAMES; i++) {
         if (g_match_manager.active_games[i].is_active &&
@@ -394,19 +423,19 @@ int remove_game(const char *game_id) {
             g_match_manager.active_games[i].is_active = false;
             g_match_manager.active_game_count--;
             LOG_INFO("Game %s removed", game_id);
-            pthread_mutex_unlock(&g_match_manager.mutex);
+            match_manager_unlock();
             return 0;
         }
     }
 
     LOG_DEBUG("Game %s not found for removal", game_id);
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
     return -1;  // 게임을 찾지 못함
 }
 
 // 매칭 매니저 상태 출력 (디버깅용)
 void print_match_manager_status(void) {
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
 
     LOG_INFO("=== Match Manager Status ===");
     LOG_INFO("Waiting players: %d/%d", g_match_manager.waiting_count, MAX_WAITING_PLAYERS);
@@ -417,7 +446,7 @@ void print_match_manager_status(void) {
         if (g_match_manager.waiting_players[i].is_active) {
             WaitingPlayer *p = &g_match_manager.waiting_players[i];
             LOG_DEBUG("  - %s (fd=%d, waiting for %ld seconds)",
-                      p->player_id, p->fd, time(NULL) - p->wait_start_time);
+                      p->player_id, p->fd, clock_wall_sec() - p->wait_start_time);
         }
     }
 
@@ -428,32 +457,78 @@ void print_match_manager_status(void) {
             LOG_DEBUG("  - %s: %s(fd=%d) vs %s(fd=%d), running for %ld seconds",
                       g->game_id, g->white_player_id, g->white_player_fd,
                       g->black_player_id, g->black_player_fd,
-                      time(NULL) - g->game_start_time);
+                      clock_wall_sec() - g->game_start_time);
         }
     }
 
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
+}
+
+void match_manager_set_draining(bool draining) {
+    match_manager_lock();
+    g_match_manager.draining = draining;
+    match_manager_unlock();
+}
+
+// 관리자 강제 종료 (승자 없음, 종료 사유는 알 수 없음으로 보낸다)
+int force_end_game(const char *game_id) {
+    if (!game_id)
+        return -1;
+
+    match_manager_lock();
+
+    for (int i = 0; i < MAX_ACTIVE_GAMES; i++) {
+        ActiveGame *game = &g_match_manager.active_games[i];
+        if (!game->is_active || strcmp(game->game_id, game_id) != 0)
+            continue;
+
+        ServerMessage    end_msg            = SERVER_MESSAGE__INIT;
+        GameEndBroadcast game_end_broadcast = GAME_END_BROADCAST__INIT;
+
+        game_end_broadcast.game_id     = game->game_id;
+        game_end_broadcast.player_id   = "";
+        game_end_broadcast.winner_team = TEAM__TEAM_UNSPECIFIED;
+        game_end_broadcast.end_type    = GAME_END_TYPE__GAME_END_UNKNOWN;
+
+        end_msg.msg_case = SERVER_MESSAGE__MSG_GAME_END;
+        end_msg.game_end = &game_end_broadcast;
+
+        if (!is_bot_fd(game->white_player_fd) && send_server_message(game->white_player_fd, &end_msg) < 0)
+            LOG_WARN("Failed to notify white player (fd=%d) of forced end", game->white_player_fd);
+        if (!is_bot_fd(game->black_player_fd) && send_server_message(game->black_player_fd, &end_msg) < 0)
+            LOG_WARN("Failed to notify black player (fd=%d) of forced end", game->black_player_fd);
+
+        game->is_active = false;
+        g_match_manager.active_game_count--;
+        LOG_INFO("Game %s force-ended by admin", game_id);
+
+        match_manager_unlock();
+        return 0;
+    }
+
+    match_manager_unlock();
+    return -1;
 }
 
 // 대기 중인 플레이어 수 반환
 int get_waiting_players_count(void) {
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
     int count = g_match_manager.waiting_count;
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
     return count;
 }
 
 // 활성 게임 수 반환
 int get_active_games_count(void) {
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
     int count = g_match_manager.active_game_count;
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
     return count;
 }
 
 // 플레이어 연결 끊김 처리
 int handle_player_disconnect(int fd) {
-    pthread_mutex_lock(&g_match_manager.mutex);
+    match_manager_lock();
 
     // 1. 대기 중인 플레이어인지 확인하고 제거
     for (int i = 0; i < MAX_WAITING_PLAYERS; i++) {
@@ -462,7 +537,7 @@ int handle_player_disconnect(int fd) {
             g_match_manager.waiting_players[i].is_active = false;
             g_match_manager.waiting_count--;
             LOG_INFO("Disconnected player removed from waiting queue (fd=%d)", fd);
-            pthread_mutex_unlock(&g_match_manager.mutex);
+            match_manager_unlock();
             return 0;
         }
     }
@@ -503,8 +578,10 @@ int handle_player_disconnect(int fd) {
             disconnect_msg.msg_case = SERVER_MESSAGE__MSG_GAME_END;
             disconnect_msg.game_end = &game_end_broadcast;
 
-            // 상대방에게 메시지 전송
-            if (send_server_message(opponent_fd, &disconnect_msg) < 0) {
+            // 상대방에게 메시지 전송 (봇이면 알릴 필요 없음)
+            if (is_bot_fd(opponent_fd)) {
+                LOG_DEBUG("Opponent is a bot, no disconnect notification needed");
+            } else if (send_server_message(opponent_fd, &disconnect_msg) < 0) {
                 LOG_WARN("Failed to send disconnect notification to opponent (fd=%d)", opponent_fd);
             } else {
                 LOG_INFO("Sent disconnect notification to opponent (fd=%d)", opponent_fd);
@@ -515,12 +592,81 @@ int handle_player_disconnect(int fd) {
             g_match_manager.active_game_count--;
             LOG_INFO("Game %s ended due to player disconnect", game->game_id);
 
-            pthread_mutex_unlock(&g_match_manager.mutex);
+            match_manager_unlock();
             return 1;  // 게임에서 연결 끊김 처리됨
         }
     }
 
     LOG_DEBUG("Disconnected player (fd=%d) was not in any active game or waiting queue", fd);
-    pthread_mutex_unlock(&g_match_manager.mutex);
+    match_manager_unlock();
     return -1;  // 매칭 상태가 아님
-}
\ No newline at end of file
+}
+
+// 대기 시간이 delay_sec 이상인 플레이어를 봇과 매칭
+// 게임 생성과 시작 알림은 mutex 안에서 처리한다 (시간 초과 브로드캐스트와 같은 방식,
+// 그 사이 이벤트 루프가 게임을 끝내거나 fd를 닫고 재사용할 수 없다)
+// 봇이 백이면 bot_move_pending만 세워 두고, 타이머 스레드가 이어서 bot_retry_pending_moves로 첫 수를 요청한다
+int match_waiting_players_with_bot(int delay_sec) {
+    static unsigned color_turn = 0;  // 같은 틱에 매칭된 플레이어도 색이 번갈아 가도록 (mutex 안에서만 접근)
+    int             count      = 0;
+    time_t          now        = clock_wall_sec();
+
+    match_manager_lock();
+
+    for (int i = 0; i < MAX_WAITING_PLAYERS && !g_match_manager.draining; i++) {
+        WaitingPlayer *player = &g_match_manager.waiting_players[i];
+        if (!player->is_active || now - player->wait_start_time < delay_sec)
+            continue;
+
+        // 빈 게임 슬롯 찾기
+        ActiveGame *game = NULL;
+        for (int j = 0; j < MAX_ACTIVE_GAMES; j++) {
+            if (!g_match_manager.active_games[j].is_active) {
+                game = &g_match_manager.active_games[j];
+                break;
+            }
+        }
+        if (!game) {
+            LOG_WARN("No available game slots for bot matching");
+            break;
+        }
+
+        init_active_game(game);
+        game->vs_bot = true;
+
+        // 색상은 매칭마다 번갈아 배정
+        bool player_is_white = (color_turn++ % 2 == 0);
+        if (player_is_white) {
+            game->white_player_fd = player->fd;
+            game->black_player_fd = BOT_PLAYER_FD;
+            strcpy(game->white_player_id, player->player_id);
+            strcpy(game->black_player_id, BOT_PLAYER_ID);
+        } else {
+            game->white_player_fd = BOT_PLAYER_FD;
+            game->black_player_fd = player->fd;
+            strcpy(game->white_player_id, BOT_PLAYER_ID);
+            strcpy(game->black_player_id, player->player_id);
+        }
+        g_match_manager.active_game_count++;
+
+        player->is_active = false;
+        g_match_manager.waiting_count--;
+
+        count++;
+
+        LOG_INFO("Bot match after %ld seconds! Game %s: %s(fd=%d) vs %s(fd=%d)",
+                 now - player->wait_start_time, game->game_id,
+                 game->white_player_id, game->white_player_fd,
+                 game->black_player_id, game->black_player_fd);
+
+        send_match_start(player->fd, game, player_is_white ? TEAM__TEAM_WHITE : TEAM__TEAM_BLACK, BOT_PLAYER_ID);
+
+        // 봇이 백이면 첫 수 요청은 mutex를 푼 뒤 bot_retry_pending_moves가 넣는다
+        if (!player_is_white)
+            game->bot_move_pending = true;
+    }
+
+    match_manager_unlock();
+
+    return count;
+}
@@ -6,13 +6,21 @@
 #include <stdint.h>
 #include <time.h>
 
+#include "legal_cache.h"
 #include "message.pb-c.h"
+#include "metrics.h"
 #include "rule.h"  // 체스 게임 상태 관리를 위해 추가
 
 #define MAX_WAITING_PLAYERS 100
 #define MAX_ACTIVE_GAMES    50
 #define GAME_ID_LENGTH      32
 
+// 봇 상대 (소켓이 없으므로 fd 자리에 음수 표식을 둔다)
+#define BOT_PLAYER_FD (-2)
+#define BOT_PLAYER_ID "ChessBot"
+
+static inline bool is_bot_fd(int fd) { return fd == BOT_PLAYER_FD; }
+
 // 매칭 상태 열거형
 typedef enum {
     MATCH_STATUS_WAITING,       // 상대방 대기 중
@@ -39,8 +47,16 @@ typedef struct
     char   black_player_id[64];          // 검은색 플레이어 ID
     time_t game_start_time;              // 게임 시작 시간
     bool   is_active;                    // 게임 활성 상태
+    bool   vs_bot;                       // 봇 상대 게임인지 여부
+    bool   bot_move_pending;             // 타이머 스레드가 봇 수 요청을 넣어야 함 (봇 백 첫 수, 워커 풀이 가득 찼던 요청)
     game_t game_state;                   // 체스 게임 보드 상태
 
+    // 현재 국면의 합법 수/체크 상태 캐시 (이동 적용 직후 갱신)
+    legal_cache_t legal_cache;
+
+    // 3회 동형 반복 판정용 국면 기록 (game_state.history가 가리킨다)
+    position_history_t position_history;
+
     // 타이머 관련 정보 (밀리초 단위로 정밀도 향상)
     int32_t time_limit_per_player;  // 각 플레이어별 제한시간 (밀리초)
     int32_t white_time_remaining;   // 백 팀 남은 시간 (밀리초)
@@ -67,12 +83,26 @@ typedef struct
     ActiveGame      active_games[MAX_ACTIVE_GAMES];        // 활성 게임들
     int             waiting_count;                         // 대기 중인 플레이어 수
     int             active_game_count;                     // 활성 게임 수
+    bool            draining;                              // 종료 대기 중 (새 매칭을 받지 않음)
     pthread_mutex_t mutex;                                 // 스레드 안전성을 위한 뮤텍스
 } MatchManager;
 
 // 매칭 매니저 전역 변수
 extern MatchManager g_match_manager;
 
+// g_match_manager.mutex 잠금 (디스패치 중에 기다리게 되면 그 시간을 lock_wait 구간에 더한다)
+static inline void match_manager_lock(void) {
+    if (pthread_mutex_trylock(&g_match_manager.mutex) == 0)
+        return;
+    uint64_t start = metrics_phase_begin();
+    pthread_mutex_lock(&g_match_manager.mutex);
+    metrics_lock_wait_end(start);
+}
+
+static inline void match_manager_unlock(void) {
+    pthread_mutex_unlock(&g_match_manager.mutex);
+}
+
 // 타이머 체크 스레드 관련 변수
 extern bool      timer_thread_running;
 extern pthread_t timer_thread_id;
@@ -87,6 +117,15 @@ int         remove_game(const char *game_id);
 char       *generate_game_id(void);
 int         handle_player_disconnect(int fd);
 
+// delay_sec 이상 기다린 대기 플레이어를 봇과 매칭 (타이머 스레드에서 호출)
+int match_waiting_players_with_bot(int delay_sec);
+
+// 새 매칭(사람/봇 모두)을 막는다, 진행 중인 게임은 그대로 둔다
+void match_manager_set_draining(bool draining);
+
+// 관리자가 게임을 강제로 끝낸다 (두 플레이어에게 종료 알림, 없으면 -1)
+int force_end_game(const char *game_id);
+
 // 디버깅/모니터링 함수
 void print_match_manager_status(void);
 int  get_waiting_players_count(void);
@@ -0,0 +1,262 @@
+#include "metrics_server.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "logger.h"
+#include "match_manager.h"
+#include "metrics.h"
+#include "server_network.h"
+
+#define METRICS_MAX_CONNECTIONS 8     // 동시에 처리하는 스크레이프 연결 수
+#define METRICS_REQUEST_MAX     2048  // 요청 머리 최대 크기
+#define METRICS_HEADER_MAX      256   // 응답 머리 최대 크기
+#define METRICS_RESPONSE_MAX    (64 * 1024)
+
+// 스크레이프 연결 (요청 머리를 다 받을 때까지 모으고, 응답은 다 보낼 때까지 EPOLLOUT으로 나눠 보낸다)
+typedef struct {
+    int    fd;  // -1이면 빈 칸
+    size_t len;
+    char   request[METRICS_REQUEST_MAX];
+    bool   responding;  // 응답을 만들었고 보내는 중 (더 읽지 않는다)
+    size_t out_len;
+    size_t out_sent;
+    char   out[METRICS_HEADER_MAX + METRICS_RESPONSE_MAX];
+} metrics_conn_t;
+
+// 이벤트 루프 스레드에서만 접근하므로 잠금 없음
+static struct {
+    int            listener;
+    metrics_conn_t conns[METRICS_MAX_CONNECTIONS];
+} g_metrics_server = {.listener = -1};
+
+int metrics_parse_port_from_args(int argc, char *argv[]) {
+    int port = DEFAULT_METRICS_PORT;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            port = atoi(argv[i + 1]);
+            if (port < 0 || port > 65535) {
+                LOG_FATAL("Invalid metrics port number: %d", port);
+                exit(EXIT_FAILURE);
+            }
+            i++;
+        }
+    }
+    return port;
+}
+
+int metrics_server_start(int epfd, int port) {
+    for (int i = 0; i < METRICS_MAX_CONNECTIONS; i++)
+        g_metrics_server.conns[i].fd = -1;
+
+    if (port == 0) {
+        LOG_INFO("Metrics endpoint disabled");
+        return -1;
+    }
+
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        log_perror("metrics: socket");
+        return -1;
+    }
+
+    int opt = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+    // 스크레이퍼는 같은 호스트의 에이전트라고 보고 루프백에만 연다
+    struct sockaddr_in addr = {0};
+    addr.sin_family         = AF_INET;
+    addr.sin_addr.s_addr    = htonl(INADDR_LOOPBACK);
+    addr.sin_port           = htons(port);
+
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, BACKLOG) < 0) {
+        log_perror("metrics: bind/listen");
+        close(fd);
+        return -1;
+    }
+
+    struct epoll_event ev = {.events = EPOLLIN, .data.fd = fd};
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        log_perror("metrics: epoll_ctl");
+        close(fd);
+        return -1;
+    }
+
+    g_metrics_server.listener = fd;
+    LOG_INFO("Metrics endpoint listening on http://127.0.0.1:%d/metrics", port);
+    return fd;
+}
+
+static metrics_conn_t *find_conn(int fd) {
+    for (int i = 0; i < METRICS_MAX_CONNECTIONS; i++) {
+        if (g_metrics_server.conns[i].fd == fd)
+            return &g_metrics_server.conns[i];
+    }
+    return NULL;
+}
+
+bool metrics_server_owns(int fd) {
+    return fd >= 0 && (fd == g_metrics_server.listener || find_conn(fd) != NULL);
+}
+
+static void close_conn(int epfd, metrics_conn_t *conn) {
+    epoll_ctl(epfd, EPOLL_CTL_DEL, conn->fd, NULL);
+    close(conn->fd);
+    conn->fd = -1;
+}
+
+static void accept_scrapers(int epfd) {
+    while (1) {
+        int fd = accept(g_metrics_server.listener, NULL, NULL);
+        if (fd < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                log_perror("metrics: accept");
+            return;
+        }
+        if (set_nonblocking(fd) < 0) {
+            close(fd);
+            continue;
+        }
+
+        metrics_conn_t    *conn = find_conn(-1);
+        struct epoll_event ev   = {.events = EPOLLIN, .data.fd = fd};
+        if (!conn || epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            LOG_WARN("Rejecting metrics connection fd=%d (too many scrapers)", fd);
+            close(fd);
+            continue;
+        }
+        conn->fd         = fd;
+        conn->len        = 0;
+        conn->responding = false;
+        conn->out_len    = 0;
+        conn->out_sent   = 0;
+    }
+}
+
+// 스크레이프 시점에 매칭 매니저 상태로 게이지를 채운다
+static void collect_gauges(void) {
+    match_manager_lock();
+    int active  = g_match_manager.active_game_count;
+    int waiting = g_match_manager.waiting_count;
+    match_manager_unlock();
+
+    metric_gauge_set(&g_metrics.active_games, active);
+    metric_gauge_set(&g_metrics.waiting_players, waiting);
+}
+
+// 응답 머리와 본문을 연결의 송신 버퍼에 담는다 (전송은 flush_output이 나눠서 한다)
+static void queue_response(metrics_conn_t *conn, const char *status, const char *content_type, const char *body, size_t body_len) {
+    int n = snprintf(conn->out, METRICS_HEADER_MAX,
+                     "HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+                     status, content_type, body_len);
+    memcpy(conn->out + n, body, body_len);
+    conn->out_len    = (size_t)n + body_len;
+    conn->out_sent   = 0;
+    conn->responding = true;
+}
+
+// 송신 버퍼를 논블로킹으로 비운다 (연결이 끊겼으면 false)
+static bool flush_output(metrics_conn_t *conn) {
+    while (conn->out_sent < conn->out_len) {
+        ssize_t n = send(conn->fd, conn->out + conn->out_sent, conn->out_len - conn->out_sent, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        conn->out_sent += (size_t)n;
+    }
+    return true;
+}
+
+static void serve_request(metrics_conn_t *conn) {
+    static char body[METRICS_RESPONSE_MAX];
+
+    if (strncmp(conn->request, "GET ", 4) != 0) {
+        static const char msg[] = "Method Not Allowed\n";
+        queue_response(conn, "405 Method Not Allowed", "text/plain", msg, sizeof(msg) - 1);
+        return;
+    }
+
+    const char *path     = conn->request + 4;
+    size_t      path_len = strcspn(path, " ?\r\n");
+    if (path_len != strlen("/metrics") || strncmp(path, "/metrics", path_len) != 0) {
+        static const char msg[] = "Not Found\n";
+        queue_response(conn, "404 Not Found", "text/plain", msg, sizeof(msg) - 1);
+        return;
+    }
+
+    collect_gauges();
+    size_t len = metrics_render(body, sizeof(body));
+    queue_response(conn, "200 OK", "text/plain; version=0.0.4", body, len);
+}
+
+// 보낼 수 있는 만큼 보내고, 다 보냈거나 끊겼으면 닫는다
+// 남았으면 EPOLLOUT만 걸어 두고 다음 루프 바퀴에서 이어 간다 (응답 중에는 더 읽지 않는다)
+static void send_pending(int epfd, metrics_conn_t *conn) {
+    if (!flush_output(conn)) {
+        LOG_WARN("Metrics response to fd=%d aborted (%zu of %zu bytes sent)", conn->fd, conn->out_sent, conn->out_len);
+        close_conn(epfd, conn);
+        return;
+    }
+    if (conn->out_sent == conn->out_len) {
+        close_conn(epfd, conn);
+        return;
+    }
+    struct epoll_event ev = {.events = EPOLLOUT, .data.fd = conn->fd};
+    epoll_ctl(epfd, EPOLL_CTL_MOD, conn->fd, &ev);
+}
+
+void metrics_server_handle(int epfd, int fd) {
+    if (fd == g_metrics_server.listener) {
+        accept_scrapers(epfd);
+        return;
+    }
+
+    metrics_conn_t *conn = find_conn(fd);
+    if (!conn)
+        return;
+
+    if (conn->responding) {
+        send_pending(epfd, conn);
+        return;
+    }
+
+    ssize_t n = recv(fd, conn->request + conn->len, METRICS_REQUEST_MAX - 1 - conn->len, 0);
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        return;
+    if (n <= 0) {
+        close_conn(epfd, conn);
+        return;
+    }
+    conn->len                += (size_t)n;
+    conn->request[conn->len]  = '\0';
+
+    // 요청 머리가 끝났거나 버퍼가 찼으면 응답을 만들어 보낸다
+    if (strstr(conn->request, "\r\n\r\n") || strstr(conn->request, "\n\n") ||
+        conn->len >= METRICS_REQUEST_MAX - 1) {
+        serve_request(conn);
+        send_pending(epfd, conn);
+    }
+}
+
+void metrics_server_stop(void) {
+    for (int i = 0; i < METRICS_MAX_CONNECTIONS; i++) {
+        if (g_metrics_server.conns[i].fd >= 0) {
+            close(g_metrics_server.conns[i].fd);
+            g_metrics_server.conns[i].fd = -1;
+        }
+    }
+    if (g_metrics_server.listener >= 0) {
+        close(g_metrics_server.listener);
+        g_metrics_server.listener = -1;
+    }
+}
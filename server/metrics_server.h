@@ -0,0 +1,22 @@
+#ifndef METRICS_SERVER_H
+#define METRICS_SERVER_H
+
+#include <stdbool.h>
+
+// 메트릭 HTTP 엔드포인트 (GET /metrics, 게임 서버와 같은 이벤트 루프에서 처리)
+
+// 명령행 인자에서 -m 포트번호를 파싱 (없으면 기본값, 0이면 끔)
+int metrics_parse_port_from_args(int argc, char *argv[]);
+
+// 127.0.0.1:port에 리슨하고 epoll에 등록 (port가 0이거나 실패하면 -1, 게임 서버는 계속 동작)
+int metrics_server_start(int epfd, int port);
+
+// fd가 메트릭 리스너나 스크레이프 연결인지
+bool metrics_server_owns(int fd);
+
+// 메트릭 fd의 epoll 이벤트 처리 (이벤트 루프 스레드 전용)
+void metrics_server_handle(int epfd, int fd);
+
+void metrics_server_stop(void);
+
+#endif  // METRICS_SERVER_H
@@ -0,0 +1,398 @@
+// perft.c
+// 규칙 엔진(is_move_legal / apply_move) 정확도 검증 및 속도 측정 도구
+//
+// 알려진 표준 국면의 perft 노드 수와 비교해 이동 규칙 오류를 잡고,
+// nodes/sec를 출력해 규칙 엔진 최적화 전후를 비교할 수 있게 한다.
+//
+// 깊은 perft는 루트 수(필요하면 두 번째 수까지)를 작업 단위로 쪼개
+// 워크 스틸링 스레드 풀에서 병렬로 센다.
+//
+// 사용법:
+//   perft [-j <threads>]                         표준 국면 전체 검증 (기본 깊이)
+//   perft -q [-j <threads>]                      빠른 검증 (얕은 깊이, ctest용)
+//   perft -d <depth> [-f <fen>] [-j <threads>]   임의 국면 perft
+//   perft -d <depth> [-f <fen>] --divide         루트 수별 노드 수 출력
+//
+// -j 기본값은 온라인 CPU 수, -j 1 이면 단일 스레드로 센다.
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "rule.h"
+#include "utils.h"
+
+#define PERFT_MAX_DEPTH   6
+#define PERFT_MAX_THREADS 256
+
+// 루트 수가 스레드당 이 개수보다 적으면 두 번째 수까지 쪼개서 작업을 늘린다
+#define PERFT_TASKS_PER_THREAD 8
+
+#define STARTPOS_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+
+// 표준 perft 국면 (https://www.chessprogramming.org/Perft_Results)
+typedef struct {
+    const char *name;
+    const char *fen;
+    int         quick_depth;             // -q 모드 검증 깊이
+    int         full_depth;              // 기본 모드 검증 깊이
+    uint64_t    nodes[PERFT_MAX_DEPTH];  // nodes[d - 1] = perft(d)
+} perft_case_t;
+
+// position4/5는 언더프로모션과 프로모션 캡처가 많은 국면
+static const perft_case_t perft_suite[] = {
+    {"startpos", STARTPOS_FEN,
+     3, 5, {20, 400, 8902, 197281, 4865609}},
+    {"kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+     2, 4, {48, 2039, 97862, 4085603}},
+    {"position3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+     3, 5, {14, 191, 2812, 43238, 674624}},
+    {"position4", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+     3, 4, {6, 264, 9467, 422333}},
+    {"position5", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+     2, 4, {44, 1486, 62379, 2103487}},
+    {"position6", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+     2, 3, {46, 2079, 89890}},
+};
+
+#define PERFT_SUITE_SIZE (int)(sizeof(perft_suite) / sizeof(perft_suite[0]))
+
+// 모노토닉 시계 (초 단위)
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// depth 수 앞까지의 말단 노드 수
+static uint64_t perft(const game_t *G, int depth) {
+    if (depth == 0)
+        return 1;
+
+    move_t moves[MAX_LEGAL_MOVES];
+    int    n = generate_legal_moves(G, moves);
+    if (depth == 1)
+        return (uint64_t)n;
+
+    uint64_t nodes = 0;
+    for (int i = 0; i < n; i++) {
+        game_t next = *G;
+        apply_move(&next, moves[i]);
+        nodes += perft(&next, depth - 1);
+    }
+    return nodes;
+}
+
+// ===================================================================
+// 워크 스틸링 병렬 perft
+// ===================================================================
+
+// 작업 단위: 루트(또는 두 번째) 수를 둔 뒤의 국면과 남은 깊이
+typedef struct {
+    game_t pos;
+    int    depth;
+    int    root;  // 루트 수 인덱스 (divide 집계용)
+} perft_task_t;
+
+// 워커별 작업 덱: 주인은 tail에서 꺼내고, 다른 워커는 head에서 훔친다
+typedef struct {
+    pthread_mutex_t lock;
+    int             head;
+    int             tail;
+    int            *items;  // perft_task_t 인덱스
+} work_deque_t;
+
+typedef struct perft_pool perft_pool_t;
+
+typedef struct {
+    perft_pool_t *pool;
+    int           id;
+    uint64_t      root_nodes[MAX_LEGAL_MOVES];  // 워커 로컬 집계 (join 후 합산)
+    int           steals;
+} perft_worker_t;
+
+struct perft_pool {
+    perft_task_t  *tasks;
+    int            task_count;
+    int            thread_count;
+    work_deque_t   deques[PERFT_MAX_THREADS];
+    perft_worker_t workers[PERFT_MAX_THREADS];
+};
+
+// 자기 덱의 뒤에서 작업 꺼내기
+static int deque_pop(work_deque_t *dq) {
+    int idx = -1;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->tail > dq->head)
+        idx = dq->items[--dq->tail];
+    pthread_mutex_unlock(&dq->lock);
+    return idx;
+}
+
+// 다른 워커 덱의 앞에서 작업 훔치기
+static int deque_steal(work_deque_t *dq) {
+    int idx = -1;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->tail > dq->head)
+        idx = dq->items[dq->head++];
+    pthread_mutex_unlock(&dq->lock);
+    return idx;
+}
+
+static void *perft_worker_main(void *arg) {
+    perft_worker_t *w    = arg;
+    perft_pool_t   *pool = w->pool;
+
+    while (1) {
+        int idx = deque_pop(&pool->deques[w->id]);
+
+        // 내 덱이 비면 다른 워커들을 차례로 돌며 훔친다
+        for (int k = 1; idx < 0 && k < pool->thread_count; k++) {
+            idx = deque_steal(&pool->deques[(w->id + k) % pool->thread_count]);
+            if (idx >= 0)
+                w->steals++;
+        }
+
+        // 작업은 실행 중에 새로 생기지 않으므로 모두 비었으면 종료
+        if (idx < 0)
+            break;
+
+        perft_task_t *t = &pool->tasks[idx];
+        w->root_nodes[t->root] += perft(&t->pos, t->depth);
+    }
+    return NULL;
+}
+
+// 루트 수를 작업으로 쪼갠다. 루트 수가 적으면 한 수 더 내려가서 쪼갠다
+static int build_tasks(const game_t *G, int depth, const move_t *roots, int root_count,
+                       int thread_count, perft_task_t **out) {
+    bool split_twice = depth >= 3 && root_count < thread_count * PERFT_TASKS_PER_THREAD;
+    int  capacity    = split_twice ? root_count * MAX_LEGAL_MOVES : root_count;
+
+    perft_task_t *tasks = malloc(sizeof(perft_task_t) * (capacity > 0 ? capacity : 1));
+    if (!tasks)
+        return -1;
+
+    int count = 0;
+    for (int i = 0; i < root_count; i++) {
+        game_t after_root = *G;
+        apply_move(&after_root, roots[i]);
+
+        if (!split_twice) {
+            tasks[count].pos   = after_root;
+            tasks[count].depth = depth - 1;
+            tasks[count].root  = i;
+            count++;
+            continue;
+        }
+
+        move_t replies[MAX_LEGAL_MOVES];
+        int    reply_count = generate_legal_moves(&after_root, replies);
+        for (int j = 0; j < reply_count; j++) {
+            tasks[count].pos = after_root;
+            apply_move(&tasks[count].pos, replies[j]);
+            tasks[count].depth = depth - 2;
+            tasks[count].root  = i;
+            count++;
+        }
+    }
+
+    *out = tasks;
+    return count;
+}
+
+// 병렬 perft. root_nodes가 NULL이 아니면 루트 수별 노드 수도 채운다
+static uint64_t perft_parallel(const game_t *G, int depth, int thread_count,
+                               move_t *roots, int *root_count, uint64_t *root_nodes) {
+    move_t local_roots[MAX_LEGAL_MOVES];
+    if (!roots)
+        roots = local_roots;
+
+    int n = generate_legal_moves(G, roots);
+    if (root_count)
+        *root_count = n;
+    if (root_nodes)
+        memset(root_nodes, 0, sizeof(uint64_t) * MAX_LEGAL_MOVES);
+
+    // 얕은 깊이나 단일 스레드는 스레드 생성 비용이 더 크다
+    if (depth <= 1 || thread_count <= 1) {
+        uint64_t total = 0;
+        for (int i = 0; i < n; i++) {
+            game_t next = *G;
+            apply_move(&next, roots[i]);
+            uint64_t nodes = perft(&next, depth - 1);
+            if (root_nodes)
+                root_nodes[i] = nodes;
+            total += nodes;
+        }
+        return depth <= 0 ? 1 : total;
+    }
+
+    perft_pool_t *pool = calloc(1, sizeof(perft_pool_t));
+    if (!pool) {
+        perror("calloc");
+        exit(EXIT_FAILURE);
+    }
+    pool->thread_count = thread_count;
+    pool->task_count   = build_tasks(G, depth, roots, n, thread_count, &pool->tasks);
+    if (pool->task_count < 0) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    // 작업을 워커 덱에 연속 구간으로 나눠 담는다 (같은 루트의 작업이 한 워커에 모이도록)
+    int *items = malloc(sizeof(int) * (pool->task_count > 0 ? pool->task_count : 1));
+    if (!items) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < pool->task_count; i++)
+        items[i] = i;
+
+    for (int t = 0; t < thread_count; t++) {
+        work_deque_t *dq = &pool->deques[t];
+        pthread_mutex_init(&dq->lock, NULL);
+        dq->items = items;
+        dq->head  = (int)((int64_t)pool->task_count * t / thread_count);
+        dq->tail  = (int)((int64_t)pool->task_count * (t + 1) / thread_count);
+
+        pool->workers[t].pool = pool;
+        pool->workers[t].id   = t;
+    }
+
+    pthread_t threads[PERFT_MAX_THREADS];
+    for (int t = 0; t < thread_count; t++) {
+        if (pthread_create(&threads[t], NULL, perft_worker_main, &pool->workers[t]) != 0) {
+            perror("pthread_create");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    uint64_t total = 0;
+    for (int t = 0; t < thread_count; t++) {
+        pthread_join(threads[t], NULL);
+        for (int i = 0; i < n; i++) {
+            total += pool->workers[t].root_nodes[i];
+            if (root_nodes)
+                root_nodes[i] += pool->workers[t].root_nodes[i];
+        }
+        pthread_mutex_destroy(&pool->deques[t].lock);
+    }
+
+    free(items);
+    free(pool->tasks);
+    free(pool);
+    return total;
+}
+
+// 루트 수별 노드 수 출력 (다른 엔진 결과와 비교해 틀린 수를 찾을 때 사용)
+static uint64_t divide(const game_t *G, int depth, int thread_count) {
+    move_t   moves[MAX_LEGAL_MOVES];
+    uint64_t root_nodes[MAX_LEGAL_MOVES];
+    int      n     = 0;
+    uint64_t total = perft_parallel(G, depth, thread_count, moves, &n, root_nodes);
+
+    for (int i = 0; i < n; i++) {
+        char str[MOVE_STR_LEN];
+        move_format(moves[i], str);
+        printf("%s: %" PRIu64 "\n", str, root_nodes[i]);
+    }
+    printf("\nMoves: %d\n", n);
+    return total;
+}
+
+// 표준 국면 검증, 실패한 항목 수 반환
+static int run_suite(bool quick, int thread_count) {
+    int      failures    = 0;
+    uint64_t total_nodes = 0;
+    double   total_time  = 0.0;
+
+    for (int c = 0; c < PERFT_SUITE_SIZE; c++) {
+        const perft_case_t *tc = &perft_suite[c];
+        game_t              G;
+        if (!fen_parse(&G, tc->fen)) {
+            printf("%-10s FEN parse error: %s\n", tc->name, tc->fen);
+            failures++;
+            continue;
+        }
+
+        int max_depth = quick ? tc->quick_depth : tc->full_depth;
+        for (int d = 1; d <= max_depth; d++) {
+            double   start   = now_sec();
+            uint64_t nodes   = perft_parallel(&G, d, thread_count, NULL, NULL, NULL);
+            double   elapsed = now_sec() - start;
+            bool     ok      = nodes == tc->nodes[d - 1];
+
+            total_nodes += nodes;
+            total_time += elapsed;
+            if (!ok)
+                failures++;
+
+            printf("%-10s depth %d: %12" PRIu64 " (expected %12" PRIu64 ") %s  %8.3fs  %10.0f nps\n",
+                   tc->name, d, nodes, tc->nodes[d - 1], ok ? "OK  " : "FAIL",
+                   elapsed, elapsed > 0 ? nodes / elapsed : 0.0);
+        }
+    }
+
+    printf("\nTotal: %" PRIu64 " nodes in %.3fs (%.0f nps), %d failure(s)\n",
+           total_nodes, total_time, total_time > 0 ? total_nodes / total_time : 0.0, failures);
+    return failures;
+}
+
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+            "Usage: %s [-q] [-j <threads>]\n"
+            "       %s -d <depth> [-f <fen>] [-j <threads>] [--divide]\n",
+            prog, prog);
+}
+
+int main(int argc, char *argv[]) {
+    bool        quick        = false;
+    bool        use_divide   = false;
+    int         depth        = 0;
+    int         thread_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    const char *fen          = STARTPOS_FEN;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-q") == 0) {
+            quick = true;
+        } else if (strcmp(argv[i], "--divide") == 0) {
+            use_divide = true;
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            fen = argv[++i];
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            thread_count = atoi(argv[++i]);
+        } else {
+            print_usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (thread_count < 1)
+        thread_count = 1;
+    if (thread_count > PERFT_MAX_THREADS)
+        thread_count = PERFT_MAX_THREADS;
+    printf("Threads: %d\n", thread_count);
+
+    if (depth <= 0)
+        return run_suite(quick, thread_count) == 0 ? 0 : 1;
+
+    game_t G;
+    if (!fen_parse(&G, fen)) {
+        fprintf(stderr, "Invalid FEN: %s\n", fen);
+        return 2;
+    }
+
+    double   start   = now_sec();
+    uint64_t nodes   = use_divide ? divide(&G, depth, thread_count)
+                                  : perft_parallel(&G, depth, thread_count, NULL, NULL, NULL);
+    double   elapsed = now_sec() - start;
+    printf("Nodes: %" PRIu64 "\nTime: %.3fs (%.0f nps)\n",
+           nodes, elapsed, elapsed > 0 ? nodes / elapsed : 0.0);
+    return 0;
+}
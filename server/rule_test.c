@@ -3,7 +3,13 @@
 
 #include <assert.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
+#include "book.h"
+#include "legal_cache.h"
+#include "search.h"
 #include "utils.h"
 
 static void test_init_startpos() {
@@ -13,15 +19,15 @@ static void test_init_startpos() {
     // 실제 보드 레이아웃 확인: board[y][x] = board[rank][file]
     // 1) 백 폰이 rank 1 (인덱스 1)에 있어야
     for (int x = 0; x < 8; x++)
-        assert(!G.board[1][x].is_dead && G.board[1][x].piece->type == PIECE_PAWN);
+        assert(piece_is(G.board[1][x], WHITE, PIECE_PAWN));
 
     // 2) 흑 폰이 rank 6 (인덱스 6)에 있어야
     for (int x = 0; x < 8; x++)
-        assert(!G.board[6][x].is_dead && G.board[6][x].piece->type == PIECE_PAWN);
+        assert(piece_is(G.board[6][x], BLACK, PIECE_PAWN));
 
     // 3) 왕·퀸 위치 - board[rank][file]
-    assert(G.board[0][4].piece->type == PIECE_KING);   // 흰 킹 e1
-    assert(G.board[7][3].piece->type == PIECE_QUEEN);  // 흑 퀸 d8
+    assert(piece_is(G.board[0][4], WHITE, PIECE_KING));   // 흰 킹 e1
+    assert(piece_is(G.board[7][3], BLACK, PIECE_QUEEN));  // 흑 퀸 d8
 
     // 4) 캐슬링 권리
     assert(G.white_can_castle_kingside &&
@@ -45,7 +51,7 @@ static void test_fen_parser() {
     // 빈 칸 확인 - board[y][x]
     for (int y = 0; y < 8; y++)
         for (int x = 0; x < 8; x++)
-            assert(G.board[y][x].is_dead);
+            assert(piece_is_empty(G.board[y][x]));
     assert(G.side_to_move == BLACK);
     assert(G.halfmove_clock == 17);
 
@@ -53,13 +59,325 @@ static void test_fen_parser() {
     ok = fen_parse(&G,
                    "r3k2r/8/8/8/8/8/8/R3K2R w KQkq e3 0 1");
     assert(ok);
-    assert(G.board[0][0].piece->type == PIECE_ROOK &&  // a1 흰 룩
-           G.board[0][7].piece->type == PIECE_ROOK);   // h1 흰 룩
+    assert(piece_is(G.board[0][0], WHITE, PIECE_ROOK) &&  // a1 흰 룩
+           piece_is(G.board[0][7], WHITE, PIECE_ROOK));   // h1 흰 룩
     assert(G.white_can_castle_kingside &&
            G.white_can_castle_queenside);
     assert(G.en_passant_x == 4 && G.en_passant_y == 2);
 }
 
+static void test_fen_writer() {
+    const char *fens[] = {
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+        "8/8/8/8/8/8/8/8 b - - 17 5",
+    };
+
+    // 파싱 -> 직렬화 왕복
+    char out[FEN_MAX_LEN];
+    for (size_t i = 0; i < sizeof(fens) / sizeof(fens[0]); i++) {
+        game_t G;
+        assert(fen_parse(&G, fens[i]));
+        assert(fen_write(&G, out) == (int)strlen(fens[i]));
+        assert(strcmp(out, fens[i]) == 0);
+    }
+
+    // 수를 두면 앙파상 칸, 반수, 풀수가 갱신되어야 한다
+    game_t G;
+    init_startpos(&G);
+    apply_move(&G, move_make(4, 1, 4, 3));  // e2e4
+    fen_write(&G, out);
+    assert(strcmp(out, "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1") == 0);
+    apply_move(&G, move_make(6, 7, 5, 5));  // g8f6
+    fen_write(&G, out);
+    assert(strcmp(out, "rnbqkb1r/pppppppp/5n2/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq - 1 2") == 0);
+}
+
+static void test_move_encoding() {
+    // 16비트 인코딩 왕복
+    move_t m = move_make(4, 1, 4, 3);  // e2e4
+    assert(sizeof(move_t) == 2);
+    assert(move_from_x(m) == 4 && move_from_y(m) == 1);
+    assert(move_to_x(m) == 4 && move_to_y(m) == 3);
+    assert(move_flag(m) == MOVE_FLAG_NORMAL);
+
+    char str[MOVE_STR_LEN];
+    move_format(m, str);
+    assert(strcmp(str, "e2e4") == 0);
+
+    // 프로모션 접미사
+    move_t p;
+    assert(move_parse("e7e8n", &p));
+    assert(move_flag(p) == MOVE_FLAG_PROMOTION && move_promotion(p) == PIECE_KNIGHT);
+    move_format(p, str);
+    assert(strcmp(str, "e7e8n") == 0);
+
+    // 잘못된 입력
+    assert(!move_parse("e2e9", &p));
+    assert(!move_parse("1-0", &p));
+    assert(!move_parse("e7e8k", &p));
+    assert(move_parse_squares("g1", "f3", &p) && move_same_squares(p, move_make(6, 0, 5, 2)));
+}
+
+static void test_underpromotion() {
+    game_t G;
+    assert(fen_parse(&G, "8/4P3/8/8/8/8/8/k6K w - - 0 1"));
+
+    // e7e8 한 칸에서 네 가지 프로모션이 모두 생성되어야 한다
+    move_t moves[MAX_LEGAL_MOVES];
+    int    n      = generate_legal_moves(&G, moves);
+    int    promos = 0;
+    for (int i = 0; i < n; i++)
+        if (move_flag(moves[i]) == MOVE_FLAG_PROMOTION)
+            promos++;
+    assert(promos == 4);
+
+    // 나이트로 승격
+    move_t m;
+    assert(move_parse("e7e8n", &m));
+    assert(is_move_legal(&G, m));
+    apply_move(&G, m);
+    assert(piece_is(G.board[7][4], WHITE, PIECE_KNIGHT));
+
+    // 플래그 없는 수는 퀸으로 승격
+    assert(fen_parse(&G, "8/4P3/8/8/8/8/8/k6K w - - 0 1"));
+    apply_move(&G, move_make(4, 6, 4, 7));
+    assert(piece_is(G.board[7][4], WHITE, PIECE_QUEEN));
+}
+
+static void test_legal_cache() {
+    game_t        G;
+    legal_cache_t cache;
+    legal_cache_reset(&cache);
+    init_startpos(&G);
+
+    const legal_cache_t *c = legal_cache_get(&cache, &G);
+    assert(c->count == 20 && !c->in_check);
+    assert(legal_cache_find(c, move_make(4, 1, 4, 3)) != MOVE_NONE);  // e2e4
+    assert(legal_cache_find(c, move_make(4, 1, 4, 4)) == MOVE_NONE);  // e2e5
+
+    // 국면이 바뀌면 해시가 달라져 다시 채워진다
+    uint64_t before = cache.hash;
+    apply_move(&G, move_make(4, 1, 4, 3));
+    c = legal_cache_get(&cache, &G);
+    assert(cache.hash != before && cache.hash == position_hash(&G));
+    assert(c->count == 20);
+
+    // 생성기가 붙인 플래그(앙파상)까지 돌려준다
+    assert(fen_parse(&G, "4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1"));
+    c = legal_cache_get(&cache, &G);
+    assert(move_flag(legal_cache_find(c, move_make(4, 4, 3, 5))) == MOVE_FLAG_EN_PASSANT);
+
+    // 체크메이트 (바보 메이트)
+    assert(fen_parse(&G, "rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3"));
+    c = legal_cache_get(&cache, &G);
+    assert(legal_cache_is_checkmate(c) && !legal_cache_is_stalemate(c));
+}
+
+static void test_mate_detection() {
+    game_t G;
+
+    // 시작 국면: 둘 다 아님
+    init_startpos(&G);
+    assert(!is_checkmate(&G) && !is_stalemate(&G));
+
+    // 바보 메이트 (백이 메이트)
+    assert(fen_parse(&G, "rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3"));
+    assert(is_checkmate(&G) && !is_stalemate(&G));
+
+    // 백 룩 백랭크 메이트 (흑이 메이트)
+    assert(fen_parse(&G, "R5k1/5ppp/8/8/8/8/8/6K1 b - - 0 1"));
+    assert(is_checkmate(&G) && !is_stalemate(&G));
+
+    // 체크가 아니거나, 체크지만 피할 수 있음
+    assert(fen_parse(&G, "4k3/8/8/8/8/8/8/R3K3 b - - 0 1"));
+    assert(!is_checkmate(&G) && !is_stalemate(&G));
+    assert(fen_parse(&G, "4k3/8/8/8/8/8/8/4RK2 b - - 0 1"));
+    assert(is_in_check(&G, BLACK) && !is_checkmate(&G) && !is_stalemate(&G));
+
+    // 스테일메이트 (흑 차례, 체크 아님, 합법 수 없음)
+    assert(fen_parse(&G, "7k/5Q2/6K1/8/8/8/8/8 b - - 0 1"));
+    assert(is_stalemate(&G) && !is_checkmate(&G));
+
+    // 합법 수 생성기와 같은 답인지
+    move_t moves[MAX_LEGAL_MOVES];
+    assert(generate_legal_moves(&G, moves) == 0);
+}
+
+static void test_draw_rules() {
+    game_t             G;
+    position_history_t hist;
+
+    // 나이트 왕복으로 시작 국면을 세 번 만든다
+    init_startpos(&G);
+    position_history_attach(&G, &hist);
+    move_t cycle[4] = {move_make(6, 0, 5, 2), move_make(6, 7, 5, 5),   // Nf3 Nf6
+                       move_make(5, 2, 6, 0), move_make(5, 5, 6, 7)};  // Ng1 Ng8
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < 4; i++) {
+            assert(!is_threefold_repetition(&G));
+            apply_move(&G, cycle[i]);
+            assert(G.hash == position_hash(&G));  // 증분 해시 일치
+        }
+    }
+    assert(is_threefold_repetition(&G));
+
+    // 폰 이동 이후에는 이전 기록과 비교하지 않는다
+    apply_move(&G, move_make(4, 1, 4, 3));
+    assert(!is_threefold_repetition(&G) && hist.count == 1);
+
+    // 캡처/프로모션/캐슬링/앙파상 후에도 증분 해시와 기물 수가 맞아야 한다
+    assert(fen_parse(&G, "r3k2r/1P6/8/3pP3/8/8/8/R3K2R w KQkq d6 0 1"));
+    move_t seq[] = {move_make(4, 4, 3, 5),                                              // exd6 e.p.
+                    move_make(4, 7, 6, 7),                                              // O-O
+                    move_make_flag(1, 6, 0, 7, MOVE_FLAG_PROMOTION, PIECE_KNIGHT)};  // bxa8=N
+    for (size_t i = 0; i < sizeof(seq) / sizeof(seq[0]); i++) {
+        apply_move(&G, seq[i]);
+        assert(G.hash == position_hash(&G));
+    }
+    assert(G.piece_count[BLACK][PIECE_PAWN] == 0 && G.piece_count[BLACK][PIECE_ROOK] == 1);
+    assert(G.piece_count[WHITE][PIECE_PAWN] == 1 && G.piece_count[WHITE][PIECE_KNIGHT] == 1);
+
+    // 기물 부족
+    assert(fen_parse(&G, "8/8/4k3/8/8/3K4/8/8 w - - 0 1"));
+    assert(is_insufficient_material(&G));
+    assert(fen_parse(&G, "8/8/4k3/8/8/3K4/5N2/8 w - - 0 1"));
+    assert(is_insufficient_material(&G));
+    assert(fen_parse(&G, "8/2b5/4k3/8/8/3K4/5B2/8 w - - 0 1"));  // 같은 색 칸 비숍
+    assert(is_insufficient_material(&G));
+    assert(fen_parse(&G, "8/3b4/4k3/8/8/3K4/5B2/8 w - - 0 1"));  // 다른 색 칸 비숍
+    assert(!is_insufficient_material(&G));
+    assert(fen_parse(&G, "8/8/4k3/8/8/3K4/4NN2/8 w - - 0 1"));
+    assert(!is_insufficient_material(&G));
+
+    // 흰 폰 캡처로 킹+나이트 vs 킹이 되는 순간 감지
+    assert(fen_parse(&G, "8/8/4k3/3P4/8/3K4/5N2/8 b - - 0 1"));
+    assert(!is_insufficient_material(&G));
+    apply_move(&G, move_make(4, 5, 3, 4));  // Kxd5
+    assert(is_insufficient_material(&G));
+}
+
+static void test_validate_game() {
+    const char *game[] = {"e2e4", "e7e5", "g1f3", "b8c6", "f1c4", "g8f6", "e1g1", "f8c5"};
+    move_t      moves[8];
+    for (int i = 0; i < 8; i++)
+        assert(move_parse(game[i], &moves[i]));
+
+    validate_result_t result;
+    assert(validate_game(moves, 8, &result));
+    assert(result.ok && result.illegal_ply == 8);
+    assert(result.final.side_to_move == WHITE && result.final.fullmove_number == 5);
+    assert(piece_is(result.final.board[0][6], WHITE, PIECE_KING));  // 캐슬링 적용
+
+    // 행마 위반 (나이트가 e5로)
+    moves[3] = move_make(1, 7, 4, 4);
+    assert(!validate_game(moves, 8, &result));
+    assert(!result.ok && result.illegal_ply == 3);
+    assert(result.final.side_to_move == BLACK);
+
+    // 자기 장군 무시 (1.e4 f6 2.Qh5+ a6??): 직전 국면으로 되돌아가야 한다
+    const char *check_game[] = {"e2e4", "f7f6", "d1h5", "a7a6"};
+    move_t      cm[4];
+    for (int i = 0; i < 4; i++)
+        assert(move_parse(check_game[i], &cm[i]));
+    assert(!validate_game(cm, 4, &result));
+    assert(result.illegal_ply == 3 && result.final.side_to_move == BLACK);
+    assert(piece_is(result.final.board[6][0], BLACK, PIECE_PAWN));  // a7 폰 그대로
+    assert(piece_is(result.final.board[4][7], WHITE, PIECE_QUEEN));  // h5 퀸
+    assert(result.final.hash == position_hash(&result.final));
+}
+
+static void test_search() {
+    tt_t tt;
+    assert(tt_init(&tt, 1));
+
+    game_t          G;
+    move_t          expected;
+    search_result_t r;
+    search_limits_t limits = {.max_depth = 4, .time_ms = 0};
+
+    // 백랭크 메이트 (Ra8#)
+    assert(fen_parse(&G, "6k1/5ppp/8/8/8/8/8/R5K1 w - - 0 1"));
+    assert(search_best_move(&G, &limits, &tt, &r));
+    assert(move_parse("a1a8", &expected) && move_same_squares(r.best, expected));
+    assert(r.score >= SCORE_MATE_MIN);
+
+    // 공짜 퀸 잡기
+    tt_clear(&tt);
+    assert(fen_parse(&G, "4k3/8/8/3q4/8/8/8/3RK3 w - - 0 1"));
+    assert(search_best_move(&G, &limits, &tt, &r));
+    assert(move_parse("d1d5", &expected) && move_same_squares(r.best, expected));
+
+    // 메이트당한 국면에서는 수가 없다
+    assert(fen_parse(&G, "R5k1/5ppp/8/8/8/8/8/6K1 b - - 0 1"));
+    assert(!search_best_move(&G, &limits, &tt, &r));
+    assert(r.best == MOVE_NONE && r.score == -SCORE_MATE);
+
+    // 평가는 차례 기준으로 대칭
+    assert(fen_parse(&G, "4k3/8/8/3q4/8/8/8/3RK3 b - - 0 1"));
+    int black_eval = evaluate(&G);
+    G.side_to_move = TEAM_WHITE;
+    assert(evaluate(&G) == -black_eval);
+
+    tt_free(&tt);
+}
+
+static void test_book() {
+    game_t G, after;
+    init_startpos(&G);
+    after = G;
+    move_t e4, d4, bogus;
+    assert(move_parse("e2e4", &e4) && move_parse("d2d4", &d4) && move_parse("e2e5", &bogus));
+    apply_move(&after, e4);
+
+    // 시작 국면 3개(불법 수 포함) + 1.e4 뒤 국면 1개, key 오름차순
+    book_entry_t entries[4] = {
+        {.key = G.hash, .move = e4, .weight = 3},
+        {.key = G.hash, .move = d4, .weight = 1},
+        {.key = G.hash, .move = bogus, .weight = 100},
+        {.key = after.hash, .move = d4, .weight = 1},
+    };
+    if (entries[3].key < entries[0].key) {
+        book_entry_t tmp = entries[3];
+        memmove(&entries[1], &entries[0], 3 * sizeof(book_entry_t));
+        entries[0] = tmp;
+    }
+    book_header_t hdr = {.magic = BOOK_MAGIC, .version = BOOK_VERSION, .count = 4, .start_hash = G.hash};
+
+    char  path[] = "/tmp/rule_test_book_XXXXXX";
+    int   fd     = mkstemp(path);
+    FILE *f      = fdopen(fd, "wb");
+    assert(f && fwrite(&hdr, sizeof(hdr), 1, f) == 1 && fwrite(entries, sizeof(entries), 1, f) == 1);
+    fclose(f);
+
+    book_t book;
+    assert(book_open(&book, path));
+    assert(book.count == 4);
+
+    const book_entry_t *first;
+    assert(book_find(&book, G.hash, &first) == 3 && first->key == G.hash);
+    assert(book_find(&book, after.hash, &first) == 1);
+    assert(book_find(&book, G.hash ^ 1, &first) == 0);
+
+    // 불법 수(e2e5)는 가중치가 커도 고르지 않는다: 난수 0..2 -> e4, 3 -> d4
+    assert(book_pick(&book, &G, 0) == e4);
+    assert(book_pick(&book, &G, 2) == e4);
+    assert(book_pick(&book, &G, 3) == d4);
+    assert(book_pick(&book, &G, 4) == e4);  // total(4)로 나눈 나머지
+
+    // 북에 없는 국면
+    game_t other;
+    assert(fen_parse(&other, "4k3/8/8/8/8/8/8/4K3 w - - 0 1"));
+    assert(book_pick(&book, &other, 0) == MOVE_NONE);
+    book_close(&book);
+
+    // 잘린 파일은 거절
+    assert(truncate(path, sizeof(hdr) + sizeof(book_entry_t)) == 0);
+    assert(!book_open(&book, path));
+    unlink(path);
+}
+
 static void test_pawn_move_f2_f4() {
     game_t G;
     init_startpos(&G);
@@ -68,28 +386,27 @@ static void test_pawn_move_f2_f4() {
 
     // f2 = file f(5), rank 2(1) → board[1][5]
     printf("f2 position: board[1][5]\n");
-    piecestate_t *piece_f2 = &G.board[1][5];
-    printf("  piece at f2: dead=%d, type=%d, team=%d, has_moved=%d\n",
-           piece_f2->is_dead,
-           piece_f2->piece ? piece_f2->piece->type : -1,
-           piece_f2->team,
-           piece_f2->has_moved);
+    piecestate_t piece_f2 = G.board[1][5];
+    printf("  piece at f2: empty=%d, type=%d, team=%d\n",
+           piece_is_empty(piece_f2),
+           piece_is_empty(piece_f2) ? -1 : piece_type(piece_f2),
+           piece_team(piece_f2));
 
     // f4 = file f(5), rank 4(3) → board[3][5]
     printf("f4 position: board[3][5]\n");
-    piecestate_t *piece_f4 = &G.board[3][5];
-    printf("  piece at f4: dead=%d, type=%d, team=%d\n",
-           piece_f4->is_dead,
-           piece_f4->piece ? piece_f4->piece->type : -1,
-           piece_f4->team);
+    piecestate_t piece_f4 = G.board[3][5];
+    printf("  piece at f4: empty=%d, type=%d, team=%d\n",
+           piece_is_empty(piece_f4),
+           piece_is_empty(piece_f4) ? -1 : piece_type(piece_f4),
+           piece_team(piece_f4));
 
     // f3 중간 칸 확인 = file f(5), rank 3(2) → board[2][5]
     printf("f3 position (middle): board[2][5]\n");
-    piecestate_t *piece_f3 = &G.board[2][5];
-    printf("  piece at f3: dead=%d, type=%d, team=%d\n",
-           piece_f3->is_dead,
-           piece_f3->piece ? piece_f3->piece->type : -1,
-           piece_f3->team);
+    piecestate_t piece_f3 = G.board[2][5];
+    printf("  piece at f3: empty=%d, type=%d, team=%d\n",
+           piece_is_empty(piece_f3),
+           piece_is_empty(piece_f3) ? -1 : piece_type(piece_f3),
+           piece_team(piece_f3));
 
     // 게임 상태 확인
     printf("\nGame state:\n");
@@ -101,40 +418,41 @@ static void test_pawn_move_f2_f4() {
     int rx = dx - sx, ry = dy - sy;
     printf("  rx = %d, ry = %d\n", rx, ry);
 
-    piecestate_t *src = &G.board[sy][sx];
-    piecestate_t *dst = &G.board[dy][dx];
+    piecestate_t src      = G.board[sy][sx];
+    piecestate_t dst      = G.board[dy][dx];
+    team_t       src_team = piece_team(src);
 
-    printf("  src->team = %d, G.side_to_move = %d\n", src->team, G.side_to_move);
-    printf("  src->team == G.side_to_move: %s\n", (src->team == G.side_to_move) ? "true" : "false");
+    printf("  src team = %d, G.side_to_move = %d\n", src_team, G.side_to_move);
+    printf("  src team == G.side_to_move: %s\n", (src_team == G.side_to_move) ? "true" : "false");
 
-    int dir = (src->team == TEAM_WHITE ? +1 : -1);
+    int dir = (src_team == TEAM_WHITE ? +1 : -1);
     printf("  dir = %d (WHITE=+1, BLACK=-1)\n", dir);
     printf("  2 * dir = %d\n", 2 * dir);
 
     printf("  Conditions for two-square pawn move:\n");
     printf("    rx == 0: %s\n", (rx == 0) ? "true" : "false");
     printf("    ry == 2 * dir: %s (%d == %d)\n", (ry == 2 * dir) ? "true" : "false", ry, 2 * dir);
-    printf("    !src->has_moved: %s\n", (!src->has_moved) ? "true" : "false");
-    printf("    dst->is_dead: %s\n", (dst->is_dead) ? "true" : "false");
-    printf("    G.board[sy + dir][sx].is_dead: %s (board[%d][%d])\n",
-           (G.board[sy + dir][sx].is_dead) ? "true" : "false", sy + dir, sx);
+    printf("    sy == start rank: %s\n", (sy == 1) ? "true" : "false");
+    printf("    dst empty: %s\n", piece_is_empty(dst) ? "true" : "false");
+    printf("    G.board[sy + dir][sx] empty: %s (board[%d][%d])\n",
+           piece_is_empty(G.board[sy + dir][sx]) ? "true" : "false", sy + dir, sx);
 
     // 자기 장군 방지 검사 디버깅
     printf("\nSelf-check prevention test:\n");
     game_t tmp = G;
-    apply_move(&tmp, sx, sy, dx, dy);
-    bool in_check_after = is_in_check(&tmp, src->team);
+    apply_move(&tmp, move_make(sx, sy, dx, dy));
+    bool in_check_after = is_in_check(&tmp, src_team);
     printf("  After f2->f4, white king in check: %s\n", in_check_after ? "true" : "false");
 
     if (in_check_after) {
         printf("  This explains why the move is illegal!\n");
     }
 
-    // f2->f4 이동 테스트 - is_move_legal(G, sx, sy, dx, dy)
+    // f2->f4 이동 테스트 - is_move_legal(G, move_make(sx, sy, dx, dy))
     // sx=file(x), sy=rank(y) 이므로 (5, 1, 5, 3)
     printf("\nTesting f2->f4 move legality:\n");
-    bool legal = is_move_legal(&G, 5, 1, 5, 3);
-    printf("  is_move_legal(G, 5, 1, 5, 3) = %s\n", legal ? "true" : "false");
+    bool legal = is_move_legal(&G, move_make(5, 1, 5, 3));
+    printf("  is_move_legal(G, move_make(5, 1, 5, 3)) = %s\n", legal ? "true" : "false");
 
     if (!legal) {
         printf("  Move is illegal! This should be a valid pawn move.\n");
@@ -144,6 +462,15 @@ static void test_pawn_move_f2_f4() {
 int main() {
     test_init_startpos();
     test_fen_parser();
+    test_fen_writer();
+    test_move_encoding();
+    test_underpromotion();
+    test_legal_cache();
+    test_mate_detection();
+    test_draw_rules();
+    test_validate_game();
+    test_search();
+    test_book();
     test_pawn_move_f2_f4();
     printf("모든 테스트 통과 🎉\n");
     return 0;
@@ -4,17 +4,27 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <netinet/in.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/eventfd.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#include "admin_server.h"
+#include "analysis.h"
+#include "capture.h"
+#include "clock.h"
 #include "handlers/handlers.h"
 #include "logger.h"
 #include "match_manager.h"
+#include "metrics.h"
+#include "metrics_server.h"
 #include "network.h"
+#include "trace.h"
+#include "worker_pool.h"
 
 // 에러 응답을 보내는 헬퍼 함수
 int send_error_response(int fd, int error_code, const char *error_message) {
@@ -116,6 +126,18 @@ int setup_epoll(int listener) {
     return epfd;
 }
 
+// 내부 알림용 fd(eventfd 등)를 epoll에 등록
+void register_event_fd(int epfd, int fd) {
+    struct epoll_event ev;
+    ev.events  = EPOLLIN;
+    ev.data.fd = fd;
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+        log_perror("epoll_ctl: event fd");
+        exit(EXIT_FAILURE);
+    }
+    LOG_DEBUG("Event fd=%d registered to epoll", fd);
+}
+
 // 새 클라이언트 연결을 accept하고 epoll에 등록
 void handle_new_connection(int listener, int epfd) {
     struct epoll_event ev;
@@ -141,6 +163,9 @@ void handle_new_connection(int listener, int epfd) {
             close(conn);
         } else {
             LOG_INFO("New client connected: fd=%d", conn);
+            metric_inc(&g_metrics.connections);
+            metric_gauge_add(&g_metrics.connected_clients, 1);
+            capture_connection_open(conn);
             new_connections++;
         }
     }
@@ -150,13 +175,71 @@ void handle_new_connection(int listener, int epfd) {
     }
 }
 
+// 종료 대기 요청 여부 (관리 소켓에서 설정, 이벤트 루프 스레드에서만 접근)
+static bool g_draining = false;
+
+void server_request_drain(void) {
+    if (g_draining)
+        return;
+    g_draining = true;
+    match_manager_set_draining(true);
+    LOG_INFO("Drain requested: no new connections or matches, waiting for %d active game(s)",
+             get_active_games_count());
+}
+
+bool server_is_draining(void) {
+    return g_draining;
+}
+
+// 종료 시그널 (핸들러는 플래그를 세우고 eventfd로 epoll_wait를 깨우기만 한다)
+static volatile sig_atomic_t g_stop_requested = 0;
+static int                   g_stop_fd        = -1;
+
+void server_request_stop(void) {
+    int      saved_errno = errno;
+    uint64_t one         = 1;
+    g_stop_requested     = 1;
+    if (g_stop_fd >= 0)
+        (void)write(g_stop_fd, &one, sizeof(one));
+    errno = saved_errno;
+}
+
+void setup_stop_event(int epfd) {
+    g_stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (g_stop_fd == -1) {
+        log_perror("eventfd: stop");
+        exit(EXIT_FAILURE);
+    }
+    register_event_fd(epfd, g_stop_fd);
+}
+
 // epoll 이벤트 루프: 새 연결 및 클라이언트 이벤트를 반복적으로 처리
 void event_loop(int listener, int epfd) {
     struct epoll_event events[MAX_EVENTS];
+    bool               listening = true;
     LOG_INFO("Starting event loop...");
 
     while (1) {
-        int nready = epoll_wait(epfd, events, MAX_EVENTS, -1);
+        // 종료 시그널을 받았으면 바로 빠져나오고, 요약과 정리는 main에서 한다
+        if (g_stop_requested) {
+            LOG_INFO("Shutdown signal received, leaving event loop");
+            break;
+        }
+
+        // 종료 대기 중이면 리스너를 빼고, 마지막 게임이 끝나면 루프를 끝낸다
+        // (게임은 타이머 스레드에서도 끝나므로 대기 중에는 1초마다 깨어나 확인한다)
+        if (g_draining) {
+            if (listening) {
+                epoll_ctl(epfd, EPOLL_CTL_DEL, listener, NULL);
+                listening = false;
+            }
+            if (get_active_games_count() == 0) {
+                LOG_INFO("Drain complete, leaving event loop");
+                break;
+            }
+        }
+
+        int nready = epoll_wait(epfd, events, MAX_EVENTS, g_draining ? 1000 : -1);
         if (nready == -1) {
             if (errno == EINTR)
                 continue;
@@ -164,6 +247,9 @@ void event_loop(int listener, int epfd) {
             break;
         }
 
+        // 이번 바퀴의 핸들러들이 함께 쓸 시각
+        clock_tick();
+
         LOG_DEBUG("epoll_wait returned %d events", nready);
 
         for (int i = 0; i < nready; i++) {
@@ -173,6 +259,19 @@ void event_loop(int listener, int epfd) {
             if (fd == listener) {
                 LOG_DEBUG("New connection event on listener");
                 handle_new_connection(listener, epfd);
+            } else if (fd == g_stop_fd) {
+                // 종료 시그널 → 다음 바퀴 첫머리에서 루프를 끝낸다
+                uint64_t count;
+                (void)read(g_stop_fd, &count, sizeof(count));
+            } else if (fd == worker_pool_event_fd()) {
+                // 워커 작업 완료 → done 콜백을 이 스레드에서 실행
+                worker_pool_drain_completions();
+            } else if (metrics_server_owns(fd)) {
+                // 메트릭 스크레이프 (리스너 또는 요청 연결)
+                metrics_server_handle(epfd, fd);
+            } else if (admin_server_owns(fd)) {
+                // 관리 소켓 (명령 수신과 목록 출력 모두 여기서 조금씩 처리)
+                admin_server_handle(epfd, fd, events[i].events);
             } else if (events[i].events & EPOLLIN) {
                 LOG_DEBUG("Client message event on fd=%d", fd);
                 handle_client_message(fd, epfd);
@@ -187,25 +286,45 @@ void cleanup(int listener, int epfd) {
     LOG_INFO("Cleaning up network resources");
     close(listener);
     close(epfd);
+    if (g_stop_fd >= 0) {
+        close(g_stop_fd);
+        g_stop_fd = -1;
+    }
     LOG_DEBUG("Network resources cleaned up");
 }
 
 // 클라이언트 소켓에서 protobuf 메시지 수신 및 처리, 연결 종료 처리
 void handle_client_message(int fd, int epfd) {
+    // 표본으로 뽑힌 요청은 수신부터 응답 전송까지 구간을 트레이스 링에 남긴다
+    trace_request_begin();
+
+    TRACE_BEGIN("receive");
     ClientMessage *msg = receive_client_message(fd);
+    TRACE_END("receive");
     if (!msg) {
         LOG_INFO("Client disconnected: fd=%d", fd);
+        metric_inc(&g_metrics.disconnects);
+        metric_gauge_add(&g_metrics.connected_clients, -1);
 
         // 연결 끊김 통합 처리 (매칭 큐 제거 및 게임 종료 처리)
         handle_player_disconnect(fd);
+        analysis_forget_client(fd);
+        capture_connection_close(fd);
 
         close(fd);
         epoll_ctl(epfd, EPOLL_CTL_DEL, fd, NULL);
+        trace_request_end();
         return;
     }
 
-    // 메시지 디스패처로 처리 위임
+    metrics_count_message_in(msg->msg_case);
+
+    // 메시지 디스패처로 처리 위임 (처리 시간을 락 대기/계산/전송 구간으로 나눠 남긴다)
+    metrics_dispatch_begin();
+
+    TRACE_BEGIN("dispatch");
     int result = dispatch_client_message(fd, msg);
+    TRACE_END("dispatch");
 
     // 핸들러에서 에러가 발생하면 에러 응답을 보냄
     if (result < 0) {
@@ -213,5 +332,10 @@ void handle_client_message(int fd, int epfd) {
         send_error_response(fd, -result, "An error occurred while processing the request");
     }
 
+    uint64_t elapsed_ns = metrics_dispatch_end(msg->msg_case);
+    if (msg->msg_case == CLIENT_MESSAGE__MSG_MOVE)
+        metric_histogram_observe(&g_metrics.move_latency, elapsed_ns / 1000);
+
     client_message__free_unpacked(msg, NULL);
+    trace_request_end();
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef NETWORK_H
 #define NETWORK_H
 
+#include <stdbool.h>
 #include <sys/epoll.h>
 
 #define DEFAULT_PORT 8080
@@ -12,9 +13,18 @@ int  set_nonblocking(int fd);
 int  parse_port_from_args(int argc, char *argv[]);
 int  create_and_bind_listener(int port);
 int  setup_epoll(int listener);
+void register_event_fd(int epfd, int fd);
 void handle_new_connection(int listener, int epfd);
 void handle_client_message(int fd, int epfd);
 void event_loop(int listener, int epfd);
+
+// 새 연결과 매칭을 막고, 진행 중인 게임이 모두 끝나면 이벤트 루프를 빠져나오게 한다 (이벤트 루프 스레드 전용)
+void server_request_drain(void);
+bool server_is_draining(void);
+
+// 종료 시그널용 eventfd를 만들어 epoll에 등록하고, 핸들러에서는 server_request_stop만 호출한다 (async-signal-safe)
+void setup_stop_event(int epfd);
+void server_request_stop(void);
 void cleanup(int listener, int epfd);
 
 // 에러 응답 헬퍼 함수
@@ -0,0 +1,262 @@
+#include "worker_pool.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "logger.h"
+
+#define WORKER_POOL_MAX_THREADS 32
+
+// 작업 한 건 (고정 크기 배열의 칸, next로 목록을 잇는다)
+typedef struct {
+    int            key;
+    work_fn_t      work;
+    work_done_fn_t done;
+    void          *arg;
+    int            next;  // 같은 목록의 다음 칸 (-1이면 끝)
+} work_item_t;
+
+// 단방향 FIFO 목록 (칸 인덱스)
+typedef struct {
+    int head;
+    int tail;
+} item_list_t;
+
+// 키별 직렬화 상태
+typedef struct {
+    bool        busy;      // 실행 중이거나 done을 기다리는 작업이 있음
+    item_list_t deferred;  // 앞 작업이 끝나길 기다리는 작업들
+} key_state_t;
+
+static struct {
+    work_item_t *items;
+    int          capacity;
+    item_list_t  free_list;
+    item_list_t  ready;      // 워커가 가져갈 작업
+    item_list_t  completed;  // 이벤트 루프가 done을 실행할 작업
+    key_state_t  keys[WORKER_POOL_MAX_KEYS];
+    int          in_use;
+
+    bool            running;
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+    pthread_t       threads[WORKER_POOL_MAX_THREADS];
+    int             thread_count;
+    int             event_fd;
+} g_pool = {.event_fd = -1};
+
+static void list_init(item_list_t *l) {
+    l->head = l->tail = -1;
+}
+
+static bool list_empty(const item_list_t *l) {
+    return l->head < 0;
+}
+
+static void list_push(item_list_t *l, int idx) {
+    g_pool.items[idx].next = -1;
+    if (l->tail < 0)
+        l->head = idx;
+    else
+        g_pool.items[l->tail].next = idx;
+    l->tail = idx;
+}
+
+static int list_pop(item_list_t *l) {
+    int idx = l->head;
+    if (idx >= 0) {
+        l->head = g_pool.items[idx].next;
+        if (l->head < 0)
+            l->tail = -1;
+    }
+    return idx;
+}
+
+// 워커 스레드: ready 목록에서 꺼내 실행하고 completed로 넘긴 뒤 eventfd로 알린다
+static void *worker_thread(void *arg) {
+    (void)arg;
+
+    while (1) {
+        pthread_mutex_lock(&g_pool.mutex);
+        while (g_pool.running && list_empty(&g_pool.ready))
+            pthread_cond_wait(&g_pool.cond, &g_pool.mutex);
+        if (!g_pool.running) {
+            pthread_mutex_unlock(&g_pool.mutex);
+            break;
+        }
+        int          idx  = list_pop(&g_pool.ready);
+        work_item_t *item = &g_pool.items[idx];
+        pthread_mutex_unlock(&g_pool.mutex);
+
+        if (item->work)
+            item->work(item->arg);
+
+        pthread_mutex_lock(&g_pool.mutex);
+        list_push(&g_pool.completed, idx);
+        pthread_mutex_unlock(&g_pool.mutex);
+
+        uint64_t one = 1;
+        if (write(g_pool.event_fd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+            log_perror("worker_pool: eventfd write");
+    }
+    return NULL;
+}
+
+int worker_pool_init(int threads, int capacity) {
+    if (threads <= 0 || threads > WORKER_POOL_MAX_THREADS || capacity <= 0)
+        return -1;
+
+    g_pool.items = calloc(capacity, sizeof(work_item_t));
+    if (!g_pool.items) {
+        log_perror("calloc");
+        return -1;
+    }
+    g_pool.capacity = capacity;
+    g_pool.in_use   = 0;
+
+    list_init(&g_pool.free_list);
+    list_init(&g_pool.ready);
+    list_init(&g_pool.completed);
+    for (int i = 0; i < capacity; i++)
+        list_push(&g_pool.free_list, i);
+    for (int k = 0; k < WORKER_POOL_MAX_KEYS; k++) {
+        g_pool.keys[k].busy = false;
+        list_init(&g_pool.keys[k].deferred);
+    }
+
+    g_pool.event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (g_pool.event_fd < 0) {
+        log_perror("eventfd");
+        free(g_pool.items);
+        g_pool.items = NULL;
+        return -1;
+    }
+
+    pthread_mutex_init(&g_pool.mutex, NULL);
+    pthread_cond_init(&g_pool.cond, NULL);
+    g_pool.running      = true;
+    g_pool.thread_count = 0;
+
+    for (int i = 0; i < threads; i++) {
+        if (pthread_create(&g_pool.threads[i], NULL, worker_thread, NULL) != 0) {
+            LOG_ERROR("Failed to create worker thread %d", i);
+            worker_pool_shutdown();
+            return -1;
+        }
+        g_pool.thread_count++;
+    }
+
+    LOG_INFO("Worker pool started (%d threads, capacity %d)", g_pool.thread_count, capacity);
+    return 0;
+}
+
+// 실행 중인 작업이 끝날 때까지 기다린 뒤 정리 (남은 작업의 done은 실행하지 않는다)
+void worker_pool_shutdown(void) {
+    if (!g_pool.items)
+        return;
+
+    pthread_mutex_lock(&g_pool.mutex);
+    g_pool.running = false;
+    pthread_cond_broadcast(&g_pool.cond);
+    pthread_mutex_unlock(&g_pool.mutex);
+
+    for (int i = 0; i < g_pool.thread_count; i++)
+        pthread_join(g_pool.threads[i], NULL);
+    g_pool.thread_count = 0;
+
+    if (g_pool.in_use > 0)
+        LOG_WARN("Worker pool shut down with %d unfinished jobs", g_pool.in_use);
+
+    pthread_cond_destroy(&g_pool.cond);
+    pthread_mutex_destroy(&g_pool.mutex);
+    close(g_pool.event_fd);
+    g_pool.event_fd = -1;
+    free(g_pool.items);
+    g_pool.items = NULL;
+    LOG_INFO("Worker pool stopped");
+}
+
+int worker_pool_submit(int key, work_fn_t work, work_done_fn_t done, void *arg) {
+    if (key != WORKER_KEY_NONE && (key < 0 || key >= WORKER_POOL_MAX_KEYS)) {
+        LOG_ERROR("Invalid worker pool key: %d", key);
+        return -1;
+    }
+
+    pthread_mutex_lock(&g_pool.mutex);
+    if (!g_pool.running || list_empty(&g_pool.free_list)) {
+        pthread_mutex_unlock(&g_pool.mutex);
+        LOG_WARN("Worker pool is full, rejecting job (key=%d)", key);
+        return -1;
+    }
+
+    int          idx  = list_pop(&g_pool.free_list);
+    work_item_t *item = &g_pool.items[idx];
+    item->key         = key;
+    item->work        = work;
+    item->done        = done;
+    item->arg         = arg;
+    g_pool.in_use++;
+
+    // 같은 키의 작업이 진행 중이면 뒤로 미룬다
+    if (key != WORKER_KEY_NONE && g_pool.keys[key].busy) {
+        list_push(&g_pool.keys[key].deferred, idx);
+    } else {
+        if (key != WORKER_KEY_NONE)
+            g_pool.keys[key].busy = true;
+        list_push(&g_pool.ready, idx);
+        pthread_cond_signal(&g_pool.cond);
+    }
+    pthread_mutex_unlock(&g_pool.mutex);
+    return 0;
+}
+
+int worker_pool_event_fd(void) {
+    return g_pool.event_fd;
+}
+
+void worker_pool_drain_completions(void) {
+    uint64_t count;
+    if (read(g_pool.event_fd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+        log_perror("worker_pool: eventfd read");
+
+    while (1) {
+        pthread_mutex_lock(&g_pool.mutex);
+        int idx = list_pop(&g_pool.completed);
+        pthread_mutex_unlock(&g_pool.mutex);
+        if (idx < 0)
+            break;
+
+        // done은 잠금 없이 실행 (done 안에서 다시 제출할 수 있다)
+        work_item_t item = g_pool.items[idx];
+        if (item.done)
+            item.done(item.arg);
+
+        // 칸 반환 후, 같은 키에 미뤄 둔 작업이 있으면 이어서 실행
+        pthread_mutex_lock(&g_pool.mutex);
+        list_push(&g_pool.free_list, idx);
+        g_pool.in_use--;
+        if (item.key != WORKER_KEY_NONE) {
+            key_state_t *ks   = &g_pool.keys[item.key];
+            int          next = list_pop(&ks->deferred);
+            if (next >= 0) {
+                list_push(&g_pool.ready, next);
+                pthread_cond_signal(&g_pool.cond);
+            } else {
+                ks->busy = false;
+            }
+        }
+        pthread_mutex_unlock(&g_pool.mutex);
+    }
+}
+
+int worker_pool_pending(void) {
+    pthread_mutex_lock(&g_pool.mutex);
+    int n = g_pool.in_use;
+    pthread_mutex_unlock(&g_pool.mutex);
+    return n;
+}
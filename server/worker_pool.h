@@ -0,0 +1,34 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <stdbool.h>
+
+// 키 없이 제출 (직렬화하지 않음)
+#define WORKER_KEY_NONE (-1)
+
+// 직렬화 키 개수 (게임 슬롯 인덱스를 키로 쓴다)
+#define WORKER_POOL_MAX_KEYS 64
+
+// work는 워커 스레드에서, done은 이벤트 루프 스레드에서 실행된다
+// done에서는 게임 상태 변경과 소켓 전송을 해도 핸들러와 경쟁하지 않는다
+typedef void (*work_fn_t)(void *arg);
+typedef void (*work_done_fn_t)(void *arg);
+
+// 워커 스레드 threads개, 동시에 제출 가능한 작업 capacity개로 시작
+int  worker_pool_init(int threads, int capacity);
+void worker_pool_shutdown(void);
+
+// 작업 제출 (어느 스레드에서든 호출 가능, 큐가 가득 차면 -1)
+// 같은 키의 작업은 한 번에 하나만 실행되고, 앞 작업의 done이 끝난 뒤 다음 작업이 시작된다
+int worker_pool_submit(int key, work_fn_t work, work_done_fn_t done, void *arg);
+
+// 완료 알림용 eventfd (이벤트 루프의 epoll에 등록)
+int worker_pool_event_fd(void);
+
+// eventfd가 읽기 가능할 때 이벤트 루프에서 호출: 완료된 작업의 done 실행
+void worker_pool_drain_completions(void);
+
+// 대기/실행 중인 작업 수 (모니터링용)
+int worker_pool_pending(void);
+
+#endif  // WORKER_POOL_H